@@ -36,6 +36,8 @@ This file is part of the USF Brainstem Data Visualization suite.
 
 using namespace std;
 
+const int SMOOTH_TIME = 16;   // ms, smooth color cycling ticks at ~60 fps
+
 // what text color contrasts best with this background?
 rgbLookUp TextContrast(rgbLookUp color)
 {
@@ -116,6 +118,12 @@ void BrainStem::loadSettings()
       pos = settings.value("ambient",0).toInt();
       ui->ambientSlider->setSliderPosition(pos);
    }
+   oitDepth = settings.value("oitDepthComplexity",OIT_DEPTH).toDouble();
+   ui->brainStemGL->setOitDepth(oitDepth);
+   kBufferSize = settings.value("kBufferSize",KBUFFER_SIZE).toInt();
+   ui->brainStemGL->setKBuffer(kBufferSize);
+   doOitEngine(settings.value("transparencyEngine",OIT_LISTS).toInt());
+   doImpostors(settings.value("impostorCells",true).toBool());
 }
 
 void BrainStem::loadCombo()
@@ -171,6 +179,10 @@ bool BrainStem::doQuit()
       settings.setValue("lightZ",ui->zLightSlider->sliderPosition());
       settings.setValue("diffuse",ui->diffuseSlider->sliderPosition());
       settings.setValue("ambient",ui->ambientSlider->sliderPosition());
+      settings.setValue("oitDepthComplexity",oitDepth);
+      settings.setValue("transparencyEngine",oitEngine);
+      settings.setValue("kBufferSize",kBufferSize);
+      settings.setValue("impostorCells",ui->actionImpostor_Cells->isChecked());
    }
    close();
    return true;
@@ -404,7 +416,11 @@ bool BrainStem::readCSV(QFile& file, QString& name)
    rgbClustMap.clear();   // build cluster number by color values lookup
    clustRGBMap.clear();
    for (int cells=CELL_COLORS::CONTROL_COLORS; cells < CELL_COLORS::NUM_CELL_COLORS; ++cells)
+   {
       dispCells[cells].clear();
+      sibCells[cells].clear();   // these point into dispCells
+      cellKeys[cells].clear();
+   }
 
      // fill the dispCells array(s)
    for ( ; iter != rows.end(); ++iter)
@@ -665,7 +681,11 @@ bool BrainStem::readDX(QFile& file,QString& name)
    rgbClustMap.clear();   // build cluster number by color values lookup
    clustRGBMap.clear();
    for (int cells=CELL_COLORS::CONTROL_COLORS; cells < CELL_COLORS::NUM_CELL_COLORS; ++cells)
+   {
       dispCells[cells].clear();
+      sibCells[cells].clear();   // these point into dispCells
+      cellKeys[cells].clear();
+   }
 
    while (p_id_iter != pos_ids.end())
    {
@@ -804,260 +824,321 @@ bool BrainStem::readDX(QFile& file,QString& name)
 // Assumes dispCells has been loaded from file.
 void BrainStem::createSibLists()
 {
-   CellIter citer, citerctl, citerstim;
-   ClusterIter ctrl, stim;
-   bool found;
+   CellIter citer;
+   ClusterIter cell;
+   cellKeyIndex::iterator sib;
+   const int period[] = {CONTROL_COLORS, STIM_COLORS};
+   const int other[] = {STIM_COLORS, CONTROL_COLORS};
+   const int sibs[] = {CTRLSIB_COLORS, STIMSIB_COLORS};
+
+   for (int list=CELL_COLORS::CONTROL_COLORS; list < CELL_COLORS::NUM_CELL_COLORS; ++list)
+   {
+      sibCells[list].clear();
+      cellKeys[list].clear();
+   }
 
    // it takes two
    if (!dispCells[CONTROL_COLORS].size() || !dispCells[STIM_COLORS].size())
       return;
 
-    // For each control cth in cluster N, 
-    // find the same cth in stim regardless of cluster
+     // index each period's cells by name, chan, and experiment. 
+     // If there are duplicates, the first one wins.
+   for (int list : period)
+      for (citer = dispCells[list].begin(); citer != dispCells[list].end(); ++citer)
+         for (size_t pos = 0; pos < citer->second.size(); ++pos)
+            cellKeys[list].emplace(cellKey(citer->second[pos]),cellIndex(citer->first,pos));
 
-     // For all control clusters
-   for (citerctl = dispCells[CONTROL_COLORS].begin(); citerctl != dispCells[CONTROL_COLORS].end(); ++citerctl)
-   {    // for each point in current cluster
-      for (ctrl = citerctl->second.begin(); ctrl != citerctl->second.end(); ++ctrl)
-      {   // search all stim clusters and points for this point 
-         found = false;
-         for (citer = dispCells[STIM_COLORS].begin(); citer != dispCells[STIM_COLORS].end() && !found; ++citer)
+    // For each control cth in cluster N, find the same cth in stim 
+    // regardless of cluster, then the same for stim cths -> ctl siblings
+   for (int pair = 0; pair < 2; ++pair)
+   {
+      cellKeyIndex& others = cellKeys[other[pair]];
+      for (citer = dispCells[period[pair]].begin(); citer != dispCells[period[pair]].end(); ++citer)
+      {
+         for (cell = citer->second.begin(); cell != citer->second.end(); ++cell)
          {
-            for (stim = citer->second.begin(); stim != citer->second.end() && !found;  ++stim)
-            {
-               if (stim->name == ctrl->name && stim->mchan == ctrl->mchan && ctrl->expidx == stim->expidx)
-               {
-                  dispCells[CTRLSIB_COLORS][ctrl->coloridx].push_back(*stim);
-                  found = true;
-               }
-            }
+            sib = others.find(cellKey(*cell));
+            if (sib != others.end())
+               sibCells[sibs[pair]][cell->coloridx].push_back(sib->second);
          }
       }
    }
+}
+
+// Fill in the report list for the control or stim period. Each cell in
+// the selected experiments gets the cluster of its sibling in the other
+// period, if it has one.
+void BrainStem::compareClusters(int period, vector<QString>& clustNames, expIdxNames& selExps, clusCompList& report)
+{
+   int other = period == CONTROL_COLORS ? STIM_COLORS : CONTROL_COLORS;
+   cellKeyIndex& others = cellKeys[other];
+   cellKeyIndex::iterator sib;
+   expIdxNames::iterator exp;
+   CellIter citer;
+   ClusterIter cell;
+   int idx;
 
-    // make stim cths -> ctl siblings
-    // for all stim clusters
-   for (citerstim = dispCells[STIM_COLORS].begin(); citerstim != dispCells[STIM_COLORS].end(); ++citerstim)
+   for (citer = dispCells[period].begin(); citer != dispCells[period].end(); ++citer)
    {
-       // for each pt in each cluster
-      for (stim=citerstim->second.begin(); stim != citerstim->second.end(); ++stim)
+      if (citer->second.begin() == citer->second.end())
+         continue;
+      report.push_back(clusCompClust());
+      clusCompClust& clust = report.back();
+      idx = citer->second.begin()->coloridx;
+      clust.clust = idx >= 0 && idx < int(clustNames.size()) ? clustNames[idx] : "FLAT";
+
+        // nothing to compare against
+      if (!dispCells[other].size())
+         continue;
+      for (cell = citer->second.begin(); cell != citer->second.end(); ++cell)
       {
-         found = false;
-         // now find sibling if there is one
-         for (citer = dispCells[CONTROL_COLORS].begin(); citer != dispCells[CONTROL_COLORS].end() && !found; ++citer)
+         exp = selExps.find(cell->expidx);
+         if (exp == selExps.end())
+            continue;
+         clusCompCell row;
+         row.name = QString::fromStdString(cell->name);
+         row.mchan = cell->mchan;
+         row.expName = exp->second;
+         sib = others.find(cellKey(*cell));
+         if (sib != others.end())
          {
-            for (ctrl = citer->second.begin(); ctrl != citer->second.end() && !found; ++ctrl)
-            {
-               if (ctrl->name == stim->name && ctrl->mchan == stim->mchan && ctrl->expidx == stim->expidx)
-               {
-                  dispCells[STIMSIB_COLORS][stim->coloridx].push_back(*ctrl);
-                  found = true;
-               }
-            }
+            idx = dispCells[other][sib->second.first][sib->second.second].coloridx;
+            row.sibClust = idx >= 0 && idx < int(clustNames.size()) ? clustNames[idx] : "FLAT";
          }
+         clust.cells.push_back(row);
       }
    }
 }
 
-QString BrainStem::lookupClusterName(int idx)
+// Save the control and stim siblings in the selected experiments
+// to a text, CSV, or JSON file. The siblings come from the cell index
+// createSibLists built, the file is written by the report thread.
+void BrainStem::doSaveClusComp()
 {
-   QString ret;
+   QString name(inName), filter, suffix;
+   vector<QString> clustNames;
+   expIdxNames selExps;
+   archTypeIter iter;
+   int row, expnum;
+
+   name += ".txt";
+   pauseTimers();
+   QString saveName = QFileDialog::getSaveFileName(this,
+                         tr("Save Cluster Compare Report."), 
+                         name, 
+                         tr("Cluster Compare Files (*.txt);;CSV Files (*.csv);;JSON Files (*.json)"),
+                         &filter);
+   restartTimers();
+   if (!saveName.length())
+      return;
+
+     // no suffix, use the one from the filter
+   suffix = QFileInfo(saveName).suffix().toLower();
+   if (suffix.isEmpty())
+   {
+      suffix = filter.section("*.",1).section(")",0,0);
+      saveName += "." + suffix;
+   }
 
+   clusCompPtr job = make_shared<clusCompReport>();
+   job->inName = inName;
+   job->saveName = saveName;
+   if (suffix == "csv")
+      job->format = REPORT_CSV;
+   else if (suffix == "json")
+      job->format = REPORT_JSON;
+   else
+      job->format = REPORT_TEXT;
+
+     // cluster and experiment names by index, flats are past the end
    if (archTypeNames.size())
    {
-      archTypeIter iter = archTypeNames.begin();
-      advance(iter,idx);
-      if (iter != archTypeNames.end()) // flats not on list
-         ret.setNum(*iter);
-      else
-         ret = "FLAT";
+      for (iter = archTypeNames.begin(); iter != archTypeNames.end(); ++iter)
+         clustNames.push_back(QString::number(*iter));
    }
    else 
    {
-      if (idx < int(rgbClustMap.size())-1)
-         ret.setNum(idx+1);
-      else
-         ret = "FLAT";
+      for (row = 0; row < int(rgbClustMap.size())-1; ++row)
+         clustNames.push_back(QString::number(row+1));
    }
-   return ret;
+   expnum = expNameModel->rowCount();
+   for (row = 0; row < expnum ; ++row)
+      if (expNameModel->item(row)->checkState() == Qt::Checked)
+         selExps[expNameModel->item(row)->data().toInt()] = expNameModel->item(row)->text();
+
+   compareClusters(CONTROL_COLORS,clustNames,selExps,job->ctlToStim);
+   compareClusters(STIM_COLORS,clustNames,selExps,job->stimToCtl);
+   emit(writeReport(job));
 }
 
-// Given an exp index, return its name
-QString BrainStem::lookupExpName(int idx)
+clusReporter::clusReporter(QObject *parent) : QObject(parent)
 {
-   QString ret;
-   int expnum = expNameModel->rowCount();
-   for (int row = 0; row < expnum ; ++row)
-     if (expNameModel->item(row)->data().toInt() == idx)
-     {
-        ret = expNameModel->item(row)->text();
-        break;
-     }
-   return ret;
 }
 
-
-// Save the control and stim siblings in the selected experiments
-// to a text file.
-void BrainStem::doSaveClusComp()
+// Stream a report to its file and say how it went.
+void clusReporter::write(clusCompPtr job)
 {
-   CellIter citer, citerctl, citerstim;
-   ClusterIter ctrl, stim;
-   bool found, inExp;
-   QString  clustReport;
-   QTextStream outp(&clustReport);
-   outp.setFieldAlignment(QTextStream::AlignLeft);
+   QString msg;
+   QFile file(job->saveName); 
 
-   int expnum = expNameModel->rowCount();
-   vector<int> selNames;
-   for (int row = 0; row < expnum ; ++row)
-      if (expNameModel->item(row)->checkState() == Qt::Checked)
-         selNames.push_back(expNameModel->item(row)->data().toInt());
+   if (!file.open(QIODevice::WriteOnly))
+   {
+      QTextStream(&msg) << tr("Error opening file ") << job->saveName << endl << tr("Error is: ") << file.errorString() << endl << endl;
+      emit(written(msg));
+      return;
+   }
+   QTextStream out(&file);
+   if (job->format == REPORT_CSV)
+      writeCSV(out,*job);
+   else if (job->format == REPORT_JSON)
+      writeJSON(out,*job);
+   else
+      writeText(out,*job);
+   out.flush();
+   if (file.error() != QFileDevice::NoError)
+      QTextStream(&msg) << tr("Error writing file ") << job->saveName << endl << tr("Error is: ") << file.errorString() << endl;
+   else
+      msg = tr("Saved cluster report to ") + job->saveName;
+   file.close();
+   emit(written(msg));
+}
 
-   outp << "Cluster Change Report for " << inName << endl << endl;
+void clusReporter::writeText(QTextStream& outp, clusCompReport& job)
+{
+   outp.setFieldAlignment(QTextStream::AlignLeft);
+   outp << "Cluster Change Report for " << job.inName << endl << endl;
    outp << "CONTROL TO STIM" << endl;
-    // For each control cth in cluster N, 
-    // find the same cth in stim regardless of cluster
-     // for all control clusters
-   for (citerctl = dispCells[CONTROL_COLORS].begin(); citerctl != dispCells[CONTROL_COLORS].end(); ++citerctl)
-   {    // for each point in current cluster
-      if (citerctl->second.begin() != citerctl->second.end())
-          outp << endl << "CONTROL CLUSTER " 
-               << lookupClusterName(citerctl->second.begin()->coloridx) << endl
-                << qSetFieldWidth(7) << left
-                << "Name"
-                << "Chan"
-                << qSetFieldWidth(32)
-                << "Experiment"
-                << qSetFieldWidth(12) // width of "stim cluster"
-                << center << "Stim Cluster" << left 
-                << qSetFieldWidth(0) << endl;
-      for (ctrl = citerctl->second.begin(); ctrl != citerctl->second.end(); ++ctrl)
-      {   // search all stim clusters and points for this point
-         found = inExp = false;
-         for (citer = dispCells[STIM_COLORS].begin(); citer != dispCells[STIM_COLORS].end() && !found; ++citer)
-         {
-            for (stim = citer->second.begin(); stim != citer->second.end() && !found;  ++stim)
-            {
-               inExp = std::find(selNames.begin(), selNames.end(), ctrl->expidx) != selNames.end();
-               if (stim->name == ctrl->name && stim->mchan == ctrl->mchan 
-                   && ctrl->expidx == stim->expidx && inExp)
-               {
-                  found = true;
-                  outp << left 
-                       << qSetFieldWidth(7)
-                       << QString::fromStdString(ctrl->name)
-                       << ctrl->mchan
-                       << qSetFieldWidth(32) 
-                       << lookupExpName(ctrl->expidx) 
-                       << qSetFieldWidth(4) << " "
-                       << qSetFieldWidth(0) 
-                       << lookupClusterName(stim->coloridx) 
-                       << qSetFieldWidth(0) << endl;
-               }
-            }
-         }
-         if (!found && inExp)
-            outp << left 
-                 << qSetFieldWidth(7)
-                 << QString::fromStdString(ctrl->name)
-                 << ctrl->mchan
-                 << qSetFieldWidth(32) 
-                 << lookupExpName(ctrl->expidx) 
+   writeTextList(outp,job.ctlToStim,true);
+   outp << endl << "STIM TO CONTROL" << endl;
+   writeTextList(outp,job.stimToCtl,false);
+}
+
+// one period's clusters in columns
+void clusReporter::writeTextList(QTextStream& outp, clusCompList& list, bool ctl)
+{
+   const QString period = ctl ? "CONTROL CLUSTER " : "STIM CLUSTER ";
+   const QString sibHead = ctl ? "Stim Cluster" : "Control Cluster";
+   const QString missing = ctl ? "Missing stim sibling" : "Missing control sibling";
+   const int sibWidth = sibHead.length();
+   const int sibPad = ctl ? 4 : 6;
+
+   for (clusCompClust& clust : list)
+   {
+      outp << endl << period << clust.clust << endl
+           << qSetFieldWidth(7) << left
+           << "Name"
+           << "Chan"
+           << qSetFieldWidth(32)
+           << "Experiment"
+           << qSetFieldWidth(sibWidth)
+           << center << sibHead << left 
+           << qSetFieldWidth(0) << endl;
+      for (clusCompCell& cell : clust.cells)
+      {
+         outp << left 
+              << qSetFieldWidth(7)
+              << cell.name
+              << cell.mchan
+              << qSetFieldWidth(32) 
+              << cell.expName;
+         if (cell.sibClust.length())
+            outp << qSetFieldWidth(sibPad) << " "
                  << qSetFieldWidth(0) 
-                 << "Missing stim sibling"
-                 << qSetFieldWidth(0) << endl;
+                 << cell.sibClust;
+         else
+            outp << qSetFieldWidth(0) 
+                 << missing;
+         outp << qSetFieldWidth(0) << endl;
       }
    }
+}
 
-     // make stim cths -> ctl siblings
-    // for all stim clusters
-    outp << endl << "STIM TO CONTROL" << endl;
-   for (citerstim = dispCells[STIM_COLORS].begin(); citerstim != dispCells[STIM_COLORS].end(); ++citerstim)
-   {
-      if (citerstim->second.begin() != citerstim->second.end())
-          outp << endl << "STIM CLUSTER " 
-               << lookupClusterName(citerstim->second.begin()->coloridx) << endl
-                << qSetFieldWidth(7) << left
-                << "Name"
-                << "Chan"
-                << qSetFieldWidth(32)
-                << "Experiment"
-                << qSetFieldWidth(15)
-                << center << "Control Cluster" << left 
-                << qSetFieldWidth(0) << endl; //  << flush;
-
-       // for each pt in each cluster
-      for (stim=citerstim->second.begin(); stim != citerstim->second.end(); ++stim)
-      {
-         // now find sibling if there is one
-         found = inExp = false;
-         for (citer = dispCells[CONTROL_COLORS].begin(); citer != dispCells[CONTROL_COLORS].end() && !found; ++citer)
-         {
-            for (ctrl = citer->second.begin(); ctrl != citer->second.end() && !found; ++ctrl)
-            {
-               inExp = std::find(selNames.begin(), selNames.end(), stim->expidx) != selNames.end();
-               if (ctrl->name == stim->name && ctrl->mchan == stim->mchan 
-                   && ctrl->expidx == stim->expidx && inExp)
-               {
-                  dispCells[STIMSIB_COLORS][stim->coloridx].push_back(*ctrl);
-                  found = true;
-                  outp << left 
-                       << qSetFieldWidth(7)
-                       << QString::fromStdString(stim->name)
-                       << stim->mchan
-                       << qSetFieldWidth(32) 
-                       << lookupExpName(stim->expidx) 
-                       << qSetFieldWidth(6) << " "
-                       << qSetFieldWidth(0) 
-                       << lookupClusterName(ctrl->coloridx) 
-                       << qSetFieldWidth(0) << endl;
-               }
-            }
-         }
-         if (!found && inExp)
-            outp << left 
-                 << qSetFieldWidth(7)
-                 << QString::fromStdString(stim->name)
-                 << stim->mchan
-                 << qSetFieldWidth(32) 
-                 << lookupExpName(stim->expidx) 
-                 << qSetFieldWidth(0)
-                 << "Missing control sibling"
-                 << qSetFieldWidth(0) << endl;
-      }
+// One row per cell, no sibling cluster if it is missing
+void clusReporter::writeCSV(QTextStream& outp, clusCompReport& job)
+{
+   outp << "direction,cluster,name,chan,experiment,sibling_cluster" << endl;
+   for (int dir = 0; dir < 2; ++dir)
+   {
+      clusCompList& list = dir ? job.stimToCtl : job.ctlToStim;
+      const char *direction = dir ? "stim_to_control" : "control_to_stim";
+      for (clusCompClust& clust : list)
+         for (clusCompCell& cell : clust.cells)
+            outp << direction << ","
+                 << csvField(clust.clust) << ","
+                 << csvField(cell.name) << ","
+                 << cell.mchan << ","
+                 << csvField(cell.expName) << ","
+                 << csvField(cell.sibClust) << endl;
    }
+}
 
-   QString name(inName);
-   name += ".txt";
-
-   pauseTimers();
+void clusReporter::writeJSON(QTextStream& outp, clusCompReport& job)
+{
+   outp << "{" << endl
+        << "  \"file\": " << jsonString(job.inName) << "," << endl
+        << "  \"control_to_stim\": [";
+   writeJSONList(outp,job.ctlToStim);
+   outp << "]," << endl
+        << "  \"stim_to_control\": [";
+   writeJSONList(outp,job.stimToCtl);
+   outp << "]" << endl << "}" << endl;
+}
 
-   QString saveName = QFileDialog::getSaveFileName(this,
-                         tr("Save Cluster Compare Report."), 
-                         name, 
-                         tr("Cluster Compare Files (*.txt)"));
-   if (saveName.length())
+// clusters and their cells, a missing sibling is null
+void clusReporter::writeJSONList(QTextStream& outp, clusCompList& list)
+{
+   for (size_t clust = 0; clust < list.size(); ++clust)
    {
-      QFile file(saveName); 
-      if (!file.open(QIODevice::WriteOnly))
+      outp << (clust ? "," : "") << endl
+           << "    {\"cluster\": " << jsonString(list[clust].clust) << ", \"cells\": [";
+      for (size_t pos = 0; pos < list[clust].cells.size(); ++pos)
       {
-         QString msg;
-         QTextStream(&msg) << tr("Error opening file ") << saveName << endl << tr("Error is: ") << file.errorString() << endl << endl;
-         printMsg(msg);
-         return;
+         clusCompCell& cell = list[clust].cells[pos];
+         outp << (pos ? "," : "") << endl
+              << "      {\"name\": " << jsonString(cell.name)
+              << ", \"chan\": " << cell.mchan
+              << ", \"experiment\": " << jsonString(cell.expName)
+              << ", \"sibling_cluster\": " << (cell.sibClust.length() ? jsonString(cell.sibClust) : QString("null"))
+              << "}";
       }
+      outp << (list[clust].cells.size() ? "\n    " : "") << "]}";
+   }
+   if (list.size())
+      outp << endl << "  ";
+}
+
+// quote a field if it has commas, quotes, or line breaks
+QString clusReporter::csvField(const QString& field)
+{
+   QString ret(field);
+   if (field.contains(QRegExp("[,\"\r\n]")))
+   {
+      ret.replace("\"","\"\"");
+      ret = "\"" + ret + "\"";
+   }
+   return ret;
+}
+
+QString clusReporter::jsonString(const QString& str)
+{
+   QString ret("\"");
+   for (QChar c : str)
+   {
+      if (c == '"' || c == '\\')
+         ret += QString("\\") + c;
+      else if (c == '\n')
+         ret += "\\n";
+      else if (c == '\r')
+         ret += "\\r";
+      else if (c == '\t')
+         ret += "\\t";
+      else if (c.unicode() < 0x20)
+         ret += QString("\\u%1").arg(c.unicode(),4,16,QChar('0'));
       else
-      {
-         QTextStream out(&file);
-         out << clustReport;
-         QString msg("Saved cluster report to ");
-         msg += name;
-         printMsg(msg);
-      }
-      file.close();
+         ret += c;
    }
-   restartTimers();
+   ret += "\"";
+   return ret;
 }
 
 
@@ -1165,7 +1246,7 @@ void BrainStem::updateCells(bool new_file, bool exp_chg)
          name_on_off[expNameModel->item(row)->data().toInt()] = 1;
    }
    ui->brainStemGL->updateCells(new_file,exp_chg,haveDelta,on_off,name_on_off,
-                                dispCells,clustRGBMap,havePhrenic);
+                                dispCells,sibCells,clustRGBMap,havePhrenic);
 }
 
 void BrainStem::checksClicked(int)
@@ -1202,9 +1283,14 @@ void BrainStem::doBackGround(int value)
 void BrainStem::setupTimers()
 {
    int ticks;
+   int twinkTime = twinkleTime;
 
+     // smooth cycling ticks faster and moves part of a bin each time
+   if (smoothCycling && twinkTime > SMOOTH_TIME)
+      twinkTime = SMOOTH_TIME;
+   twinkleStep = twinkleTime ? double(twinkTime)/twinkleTime : 1.0;
    masterOn = true;
-   movieTime = min(spinTime,twinkleTime);
+   movieTime = min(spinTime,twinkTime);
    if (movieTime >= 1000.0/24)          // we save assuming at least 24 fps
    {
       movieTime = floor(1000.0/24);  // so make movie timer fire at least that often
@@ -1228,11 +1314,11 @@ void BrainStem::setupTimers()
       masterTimer->stop();
       twinkleTick = twinkleTickRefresh = 1;
       if (framesPerSec <= 24)
-         twinkleMovieRefresh = twinkleTime/movieTime;
+         twinkleMovieRefresh = twinkTime/movieTime;
       else
          twinkleMovieRefresh = 1;
       spinTick = -1;
-      activeTime = twinkleTime;
+      activeTime = twinkTime;
    }
    else if (!spinOn && !twinkleOn)
    {
@@ -1247,9 +1333,9 @@ void BrainStem::setupTimers()
    else  // both on
    {
       masterTimer->stop(); 
-      if (spinTime >= twinkleTime) // twinkle drives the timer
+      if (spinTime >= twinkTime) // twinkle drives the timer
       {
-         ticks = floor(float(spinTime)/twinkleTime);
+         ticks = floor(float(spinTime)/twinkTime);
          if (ticks < 1)
             ticks = 1;
          spinTickRefresh = spinTick = ticks;
@@ -1258,18 +1344,18 @@ void BrainStem::setupTimers()
          spinMovieRefresh = spinMovieTick = ticks;
          twinkleMovieTick = 1; 
          twinkleMovieRefresh = 1;
-         activeTime = twinkleTime;
+         activeTime = twinkTime;
       }
       else  // spin drives timer
       {
-         ticks = floor(float(twinkleTime)/spinTime);
+         ticks = floor(float(twinkTime)/spinTime);
          if ( ticks < 1)
             ticks = 1;
          twinkleTickRefresh = twinkleTick = ticks;
          spinTick = 1; 
          spinTickRefresh = 1;
          if (framesPerSec <= 24)
-            twinkleMovieRefresh = twinkleMovieTick = twinkleTime/movieTime;
+            twinkleMovieRefresh = twinkleMovieTick = twinkTime/movieTime;
          else
             twinkleMovieRefresh = twinkleMovieTick = ticks;
          spinMovieTick = 1; 
@@ -1435,10 +1521,10 @@ void BrainStem::doToggleColorCycling()
    ui->brainStemGL->doToggleColorCycling(twinkleOn);
 }
 
-// twinkle timer fired or single step button clicked, tell GL window about it
+// twinkle timer fired, tell GL window about it
 void BrainStem::doTwinkle()
 {
-   ui->brainStemGL->twinkleAgain();
+   ui->brainStemGL->twinkleAgain(twinkleStep);
 }
 
 // we have a new frame, if making a movie, save it
@@ -1485,10 +1571,41 @@ void BrainStem::doNextStep()
    ui->twinkleSlider->setEnabled(true);
 
    ui->brainStemGL->singleStep(true);
-   doTwinkle();                 // button instead of timer
+   ui->brainStemGL->twinkleAgain(); // button instead of timer, one whole bin
+}
+
+// toggle blending between bins when color cycling
+void BrainStem::doSmoothCycling(bool checked)
+{
+   smoothCycling = checked;
+   if (twinkleOn)
+      setupTimers();
 }
 
 
+// Pick how transparency is drawn. Lists are exact but memory use grows
+// with how many layers there are, weighted blending is fast and fixed size
+// but approximate, depth peeling is exact and fixed size but slower. The
+// k-buffer is the lists with only the nearest layers sorted exactly.
+void BrainStem::doOitEngine(int engine)
+{
+   if (engine < OIT_LISTS || engine >= OIT_ENGINES)
+      engine = OIT_LISTS;
+   oitEngine = engine;
+   ui->actionOitLists->setChecked(engine == OIT_LISTS);
+   ui->actionOitWeighted->setChecked(engine == OIT_WEIGHTED);
+   ui->actionOitPeel->setChecked(engine == OIT_PEEL);
+   ui->actionOitKBuffer->setChecked(engine == OIT_KBUFFER);
+   ui->brainStemGL->setOitEngine(engine);
+}
+
+// Cells as ray cast spheres on a square each, or as sphere meshes
+void BrainStem::doImpostors(bool on)
+{
+   ui->actionImpostor_Cells->setChecked(on);
+   ui->brainStemGL->setImpostors(on);
+}
+
 // fast animations use up all the cpu, so the dialog boxes
 // never get drawn.  If timers are running, stop them, and
 // remember their state so we can restart them later.
@@ -54,6 +54,16 @@ BrainStem::BrainStem(QWidget *parent) : QMainWindow(parent), ui(new Ui::BrainSte
       // let GL window talk to us
    connect(ui->brainStemGL,SIGNAL(chatBox(QString)),this,SLOT(glMsg(QString)));
 
+     // cluster compare reports are written in their own thread
+   qRegisterMetaType<clusCompPtr>("clusCompPtr");
+   reportThread = new QThread(this);
+   reporter = new clusReporter;
+   reporter->moveToThread(reportThread);
+   connect(this,&BrainStem::writeReport,reporter,&clusReporter::write);
+   connect(reporter,&clusReporter::written,this,&BrainStem::printMsg);
+   connect(reportThread,&QThread::finished,reporter,&QObject::deleteLater);
+   reportThread->start();
+
      // setup click event for dynamic checkboxes for brain regions
    checksMapper = new QSignalMapper(this);
    connect(checksMapper,SIGNAL(mapped(int)),this,SLOT(checksClicked(int)));
@@ -82,6 +92,8 @@ BrainStem::BrainStem(QWidget *parent) : QMainWindow(parent), ui(new Ui::BrainSte
 
 BrainStem::~BrainStem()
 {
+   reportThread->quit();   // finishes a report in progress
+   reportThread->wait();
    delete ui;
 }
 
@@ -399,3 +411,33 @@ void BrainStem::on_actionSaveClustComp_triggered()
 {
    doSaveClusComp();
 }
+
+void BrainStem::on_actionSmooth_Cycling_triggered(bool checked)
+{
+   doSmoothCycling(checked);
+}
+
+void BrainStem::on_actionOitLists_triggered()
+{
+   doOitEngine(OIT_LISTS);
+}
+
+void BrainStem::on_actionOitWeighted_triggered()
+{
+   doOitEngine(OIT_WEIGHTED);
+}
+
+void BrainStem::on_actionOitPeel_triggered()
+{
+   doOitEngine(OIT_PEEL);
+}
+
+void BrainStem::on_actionOitKBuffer_triggered()
+{
+   doOitEngine(OIT_KBUFFER);
+}
+
+void BrainStem::on_actionImpostor_Cells_triggered(bool checked)
+{
+   doImpostors(checked);
+}
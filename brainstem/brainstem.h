@@ -37,11 +37,15 @@ This file is part of the USF Brainstem Data Visualization suite.
 #include <QStandardItem>
 #include <QTemporaryDir>
 #include <QWhatsThis>
+#include <QTextStream>
+#include <QThread>
 
 #include <map>
+#include <unordered_map>
 #include <set>
 #include <vector>
 #include <tuple>
+#include <memory>
 #include <unistd.h>
 #include <ios>
 #include <iostream>
@@ -240,6 +244,7 @@ using dxCellPtMapIter = dxCellPtMap::iterator;
 // set of experiment names
 using expNameSet = std::map <QString,int>;
 using expNameIter = expNameSet::iterator;
+using expIdxNames = std::unordered_map <int,QString>;   // exp # to name
 using expNameInsert = std::pair<expNameIter,bool>;
 
 using CTH = std::vector <double>;
@@ -289,6 +294,41 @@ using Cells = std::map <int,Cluster>;
 using CellIter = Cells::iterator;
 using cellArray = std::array <Cells,CELL_COLORS::NUM_CELL_COLORS>;
 
+// Where a record is in one of the period lists, its cluster and position.
+// Sibling lists are these instead of copies of the records.
+using cellIndex = std::pair <int,size_t>;
+using SibCells = std::map <int,std::vector<cellIndex>>;
+using SibIter = SibCells::iterator;
+using sibArray = std::array <SibCells,CELL_COLORS::NUM_CELL_COLORS>;  // only SIB lists
+
+// The same cell in different periods has the same name, chan, and experiment
+class cellKey
+{
+   public:
+      cellKey(const OneRec& rec) : name(rec.name),mchan(rec.mchan),expidx(rec.expidx) {} ;
+      bool operator==(const cellKey& other) const
+      {
+         return mchan == other.mchan && expidx == other.expidx && name == other.name;
+      }
+      std::string name;
+      int mchan;
+      int expidx;
+};
+
+class cellKeyHash
+{
+   public:
+      size_t operator()(const cellKey& key) const
+      {
+         size_t hash = std::hash<std::string>()(key.name);
+         hash ^= std::hash<int>()(key.mchan) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+         hash ^= std::hash<int>()(key.expidx) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+         return hash;
+      }
+};
+using cellKeyIndex = std::unordered_map <cellKey,cellIndex,cellKeyHash>;
+using cellKeyArray = std::array <cellKeyIndex,CELL_COLORS::NUM_CELL_COLORS>; // by period
+
 using BrainSel = std::vector<int>;
 using BrainSelIter = BrainSel::iterator;
 
@@ -297,6 +337,66 @@ using NameSelIter = NameSel::iterator;
 
 using comboList = std::map<QString,comboPick>;
 
+enum REPORT_FMT {REPORT_TEXT, REPORT_CSV, REPORT_JSON};
+
+// One cell in the cluster compare report. sibClust is empty if the cell
+// does not have a sibling in the other period.
+class clusCompCell
+{
+   public:
+      QString name;
+      int mchan;
+      QString expName;
+      QString sibClust;
+};
+
+// A control or stim cluster and its cells in the selected experiments
+class clusCompClust
+{
+   public:
+      QString clust;
+      std::vector<clusCompCell> cells;
+};
+using clusCompList = std::vector<clusCompClust>;
+
+// Everything needed to write a cluster compare report.  It is filled in
+// from the cell lists in the GUI thread, the writer never sees them.
+class clusCompReport
+{
+   public:
+      QString inName;
+      QString saveName;
+      REPORT_FMT format = REPORT_TEXT;
+      clusCompList ctlToStim;
+      clusCompList stimToCtl;
+};
+using clusCompPtr = std::shared_ptr<clusCompReport>;
+Q_DECLARE_METATYPE(clusCompPtr)
+
+// Writes cluster compare reports to disk in its own thread.
+class clusReporter : public QObject
+{
+   Q_OBJECT
+
+   public:
+      explicit clusReporter(QObject *parent = 0);
+
+   signals:
+      void written(QString);
+
+   public slots:
+      void write(clusCompPtr);
+
+   private:
+      void writeText(QTextStream&, clusCompReport&);
+      void writeTextList(QTextStream&, clusCompList&, bool);
+      void writeCSV(QTextStream&, clusCompReport&);
+      void writeJSON(QTextStream&, clusCompReport&);
+      void writeJSONList(QTextStream&, clusCompList&);
+      QString csvField(const QString&);
+      QString jsonString(const QString&);
+};
+
 namespace Ui {
 class BrainStem;
 }
@@ -317,6 +417,7 @@ class BrainStem : public QMainWindow
     void printMsg(QString);
 
    signals:
+      void writeReport(clusCompPtr);
 
    private slots:
       void on_Quit_clicked();
@@ -390,6 +491,12 @@ class BrainStem : public QMainWindow
       void on_actionSave_Figure_Settings_triggered();
       void on_brainStemGL_resized();
       void on_actionSaveClustComp_triggered();
+      void on_actionSmooth_Cycling_triggered(bool checked);
+      void on_actionOitLists_triggered();
+      void on_actionOitWeighted_triggered();
+      void on_actionOitPeel_triggered();
+      void on_actionOitKBuffer_triggered();
+      void on_actionImpostor_Cells_triggered(bool checked);
 
    protected:
       void closeEvent(QCloseEvent *evt);
@@ -399,8 +506,12 @@ class BrainStem : public QMainWindow
      RGBClust rgbClustMap;
      ClustRGB clustRGBMap;
      cellArray dispCells;
+     sibArray sibCells;
+     cellKeyArray cellKeys;
      archType archTypeNames;
      QString  inName;
+     QThread *reportThread;
+     clusReporter *reporter;
 
        // brain regions
      QSignalMapper *checksMapper;
@@ -422,6 +533,8 @@ class BrainStem : public QMainWindow
 
      bool twinkleOn = false;
      int twinkleTime = 0;
+     bool smoothCycling = false;
+     double twinkleStep = 1.0;   // bins per twinkle tick
      int spinMovieTick;
      int twinkleMovieTick;
      int spinMovieRefresh;
@@ -462,6 +575,9 @@ class BrainStem : public QMainWindow
      bool haveDelta = false;
      STEREO_MODE stereoMode;
      bool havePhrenic = true;
+     double oitDepth;   // avg fragments per pixel for transparency
+     int oitEngine;     // how transparency is drawn, an OIT_ENGINE
+     int kBufferSize;   // nearest fragments the k-buffer engine sorts
 
        // handle signals from UI
      bool doQuit();
@@ -528,8 +644,10 @@ class BrainStem : public QMainWindow
      void saveFigureSettings();
      void forceEven();
      void doSaveClusComp();
-     QString lookupExpName(int);
-     QString lookupClusterName(int);
+     void doSmoothCycling(bool);
+     void doOitEngine(int);
+     void doImpostors(bool);
+     void compareClusters(int, std::vector<QString>&, expIdxNames&, clusCompList&);
 };
 
 
@@ -31,7 +31,6 @@ SOURCES += main.cpp\
            all_structures.c \
            outlines.c \
            atlasnames.c \
-           sphere.c \
            helpbox.cpp
 
 
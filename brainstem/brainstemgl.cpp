@@ -26,8 +26,15 @@ This file is part of the USF Brainstem Data Visualization suite.
 
 #include "brainstem.h"
 #include <QSurfaceFormat>
+#include <QStandardPaths>
+#include <QCryptographicHash>
+#include <QSaveFile>
+#include <QDir>
+#include <QElapsedTimer>
 #include <QtOpenGL>
 #include <QOpenGLExtraFunctions>
+#include <numeric>
+#include <algorithm>
 #include "brainstemgl.glsl"
 
 using namespace std;
@@ -44,10 +51,7 @@ extern const int numStructs;
 extern const int numNormStructs;
 extern GLfloat brainSkin[][3];
 extern GLfloat skinNorms[][3];
-extern GLfloat sphereVert[][3];
-extern GLfloat sphereNorm[][3];
 extern const int numbrainSkin, numskinNorms;
-extern const int numsphereVert, numsphereNorm;
 }
 
 const int settingsMarker=0xFEEE;
@@ -62,7 +66,7 @@ const float MAJOR_TICK = 1.0;
 const float MINOR_TICK = 0.5;
 const float MAJOR_TICK_LEN = 0.4;
 const float MINOR_TICK_LEN = 0.2;
-const int COLOR_STEPS = 16;      // These MUST be > 2
+const int COLOR_STEPS = 16;      // These MUST be > 2, and match the cell shader
 const int D_COLOR_STEPS = 8;
 
 const int DRAWBOX_W = 340;
@@ -111,20 +115,80 @@ GLfloat drawTextureBox[] =
 
 BrainStemGL::BrainStemGL(QWidget *parent) : QOpenGLWidget(parent)
 {
+   oneStruct curr_offset;
+
     // limit these for multiple or 4K monitors
    setMaximumWidth(MAX_FB_WIDTH);
    setMaximumHeight(MAX_FB_HEIGHT);
+
+    // where each structure is in the vertices stemStructs() loads
+   for (int count = 0; count < numStructs; ++count)
+   {
+      curr_offset.first = objSizes[count][0];
+      curr_offset.count = objSizes[count][1];
+      selStructs.push_back(curr_offset);
+   }
 }
 
 BrainStemGL::~BrainStemGL()
 {
+   if (uploadThread)
+   {
+      uploadThread->quit();
+      uploadThread->wait();
+   }
    makeCurrent();
+     // uploads the thread finished, or never got to, that weren't swapped in
+   for (cellUploadPtr& job : uploadJobs)
+      freeUpload(*job);
+   uploadJobs.clear();
+   delete uploader;
    clearClusts();
-   glDeleteProgram(outlineProg);
-   glDeleteProgram(axesProg);
-   glDeleteProgram(sort_skinProg);
-   if (cellProg)
-      glDeleteProgram(cellProg);
+   for (int slot = 0; slot < FRAME_SLOTS; ++slot)
+      if (frameFence[slot])
+         glDeleteSync(frameFence[slot]);
+   if (frameRingPtr)
+   {
+      glBindBuffer(GL_UNIFORM_BUFFER,frameRingBuff);
+      glUnmapBuffer(GL_UNIFORM_BUFFER);
+   }
+   glDeleteBuffers(1,&frameRingBuff);
+   if (counterReadPtr)
+   {
+      glBindBuffer(GL_COPY_WRITE_BUFFER,counterReadBuff);
+      glUnmapBuffer(GL_COPY_WRITE_BUFFER);
+   }
+   glDeleteBuffers(1,&counterReadBuff);
+   for (int view = 0; view < VIEWS; ++view)
+   {
+      glDeleteProgram(outlineProgs[view]);
+      glDeleteProgram(axesProgs[view]);
+      glDeleteProgram(sort_skinProgs[view]);
+      glDeleteProgram(composeProgs[view]);
+      glDeleteProgram(kBufferProgs[view]);
+   }
+   if (headClearProg)
+      glDeleteProgram(headClearProg);
+   if (tileBinBuff)
+   {
+      glDeleteProgram(tileClassProg);
+      for (int cls = TILE_SHORT; cls < TILE_CLASSES; ++cls)
+         glDeleteProgram(tileSortProg[cls]);
+      glDeleteBuffers(1,&tileBinBuff);
+      glDeleteTextures(1,&resolveTex);
+      glDeleteTextures(1,&tileUsedTex);
+   }
+   if (oitFbo)
+   {
+      glDeleteTextures(OIT_TARGETS,oitTex);
+      glDeleteTextures(1,&oitDepthTex);
+      glDeleteFramebuffers(1,&oitFbo);
+      glDeleteQueries(PEEL_PASSES,peelQuery);
+   }
+   for (GLuint prog : cellPrograms())
+      glDeleteProgram(prog);
+   if (cellCullProg)
+      glDeleteProgram(cellCullProg);
 }
 
 QByteArray BrainStemGL::saveSettings()
@@ -182,13 +246,20 @@ void BrainStemGL::applyPrefs()
 void BrainStemGL::initializeGL()
 {
    QSurfaceFormat surfFormat;
+   GLint linked = GL_FALSE;
+   GLint formats = 0;
+   QElapsedTimer timer;
+   QString phases;
+   void (APIENTRYP compilerThreads)(GLuint) = nullptr;
+   auto phase = [&](const char* name)   // how long startup spends where, for -d
+   {
+      QTextStream(&phases) << name << " " << timer.restart() << " ms, ";
+   };
 
+   timer.start();
    initializeOpenGLFunctions();
    applyPrefs();
-   glClearColor(backColor,backColor,backColor,1.0);
-   glm::vec3 dist(dX,dY,dZ);
-   glm::vec3 amb(ambient/100.0,ambient/100.0,ambient/100.0);
-   glm::vec3 dif(diffuse/100.0,diffuse/100.0,diffuse/100.0);
+   glClearColor(backColor,backColor,backColor,0.0);  // transparent background
 
     // display interesting info
    QString msg;
@@ -237,7 +308,40 @@ void BrainStemGL::initializeGL()
       QTextStream(&msg)<< "MAX_COMBINED_GL_TEXTURE_UNITS: " << intval << endl; 
     }
 
+     // Geometry shaders are slow, let the vertex shaders pick the viewport
+     // if the driver can
+   if (context()->hasExtension(QByteArrayLiteral("GL_ARB_shader_viewport_layer_array")))
+      vsViewportExt = "#extension GL_ARB_shader_viewport_layer_array : require\n";
+   else if (context()->hasExtension(QByteArrayLiteral("GL_AMD_vertex_shader_viewport_index")))
+      vsViewportExt = "#extension GL_AMD_vertex_shader_viewport_index : require\n";
+   vsViewports = vsViewportExt != nullptr;
+   if (Debug)
+      QTextStream(&msg) << "Viewports picked in the " << (vsViewports ? "vertex" : "geometry") << " shaders" << endl;
+
+     // Linked programs are kept on disk for the next run, see buildProgram().
+     // The driver's binaries are only good for the driver that made them.
+   glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS,&formats);
+   if (formats > 0)
+   {
+      shaderCache = QStandardPaths::writableLocation(QStandardPaths::CacheLocation) + "/shaders";
+      if (!QDir().mkpath(shaderCache))
+         shaderCache.clear();
+      shaderCacheId = QByteArray(reinterpret_cast<const char*>(glGetString(GL_RENDERER))) + '\n'
+                    + QByteArray(reinterpret_cast<const char*>(glGetString(GL_VERSION)));
+   }
+
+     // Let the driver compile on all the cores it likes, see buildProgram()
+   if (context()->hasExtension(QByteArrayLiteral("GL_KHR_parallel_shader_compile")))
+      compilerThreads = reinterpret_cast<decltype(compilerThreads)>(context()->getProcAddress("glMaxShaderCompilerThreadsKHR"));
+   else if (context()->hasExtension(QByteArrayLiteral("GL_ARB_parallel_shader_compile")))
+      compilerThreads = reinterpret_cast<decltype(compilerThreads)>(context()->getProcAddress("glMaxShaderCompilerThreadsARB"));
+   if (compilerThreads)
+      compilerThreads(0xFFFFFFFF);
+   if (Debug)
+      QTextStream(&msg) << "Shaders compiled " << (compilerThreads ? "in parallel" : "one at a time") << endl;
+
    emit(chatBox(msg));
+   phase("context");
 
    phrenicLinePos = PHRENIC_I_START;
    glDisable(GL_CULL_FACE);
@@ -248,218 +352,86 @@ void BrainStemGL::initializeGL()
    phrenicImageG.load(":/phrenic_scaled_norm_transp_green.png"); // pngs in program image
    noPhrenicImage.load(":/nophrenic_transp.png");
 
-   vertVShader = glCreateShader(GL_VERTEX_SHADER);
-   glShaderSource(vertVShader,1,&vertexVSrc,nullptr);
-   glCompileShader(vertVShader);
-   chkcomp(vertVShader,"vertVShader");
-
-   vertGShader = glCreateShader(GL_GEOMETRY_SHADER);
-   glShaderSource(vertGShader,1,&vertexGSrc,nullptr);
-   glCompileShader(vertGShader);
-   chkcomp(vertGShader,"vertGShader");
-
-   outlineFShader = glCreateShader(GL_FRAGMENT_SHADER);
-   glShaderSource(outlineFShader,1,&outlineFSrc,nullptr);
-   glCompileShader(outlineFShader);
-   chkcomp(outlineFShader,"outlineFShader");
-
-   axesFShader = glCreateShader(GL_FRAGMENT_SHADER);
-   glShaderSource(axesFShader,1,&axesFSrc,nullptr);
-   glCompileShader(axesFShader);
-   chkcomp(axesFShader,"axesFShader");
-
-      // create & link shader programs
-   outlineProg = glCreateProgram();
-   glAttachShader(outlineProg,vertVShader);
-   glAttachShader(outlineProg,vertGShader);
-   glAttachShader(outlineProg,outlineFShader);
-   glLinkProgram(outlineProg);
-   chklink(outlineProg,"outlineProg");
-
-   axesProg = glCreateProgram();
-   glAttachShader(axesProg,vertVShader);
-   glAttachShader(axesProg,vertGShader); // shared
-   glAttachShader(axesProg,axesFShader);
-   glLinkProgram(axesProg);
-   chklink(axesProg,"axesProg");
-
-     // build a uniform buffer object (UBO) to share vertex shader transform matrix
-   mvpSize = sizeof(mvpMat);
-   glGenBuffers(1,&vUboBuff);
-   glBindBuffer(GL_UNIFORM_BUFFER,vUboBuff);
-   glBufferData(GL_UNIFORM_BUFFER, mvpSize, nullptr,GL_DYNAMIC_DRAW); // reserve space
-
-      // build ubo for shared lighting normal transform matrix
-   mvSize = sizeof(mvMat);
-   glGenBuffers(1,&nUboBuff);
-   glBindBuffer(GL_UNIFORM_BUFFER,nUboBuff);
-   glBufferData(GL_UNIFORM_BUFFER, mvSize, nullptr,GL_DYNAMIC_DRAW); // reserve space
-
-   glGenBuffers(1,&sUboBuff);
-   glBindBuffer(GL_UNIFORM_BUFFER,sUboBuff);
-   glBufferData(GL_UNIFORM_BUFFER, sizeof(stereoMode), nullptr,GL_DYNAMIC_DRAW);
-   void* stereo_ptr = glMapBufferRange(GL_UNIFORM_BUFFER,0,sizeof(stereoMode),
-                             GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT);
-   memcpy(stereo_ptr,&stereoMode,sizeof(stereoMode));
-   glUnmapBuffer(GL_UNIFORM_BUFFER);
-
-     // init shader vars
-   glUseProgram(outlineProg);
-   outlineColor = glGetUniformLocation(outlineProg,"outlineColor");
-   glUniform4fv(outlineColor,1,glm::value_ptr(outlineColorVal));
-
-   glUseProgram(axesProg);
-   axesColor = glGetUniformLocation(axesProg,"axesColor");
-   glUniform4fv(axesColor,1,glm::value_ptr(axesColorVec));
+      // Start the programs the first frame needs. The driver compiles them
+      // while the buffers are made, then finishPrograms() waits for them.
+      // Outlines, structures, and the k-buffer are made when first used.
+   viewPrograms(axesProgs,VIEWS,{vertexVSrc},{vertexGSrc},{GL_FRAGMENT_SHADER,"",{axesFSrc}},"axesProg");
 
      // rectangle we print on.  This lives in fixed 
      // world space coords, so no transforms
-   printVShader = glCreateShader(GL_VERTEX_SHADER);
-   glShaderSource(printVShader,1,&printVSrc,nullptr);
-   glCompileShader(printVShader);
-   chkcomp(printVShader,"printShader");
-   printFShader = glCreateShader(GL_FRAGMENT_SHADER);
-   glShaderSource(printFShader,1,&printFSrc,nullptr);
-   glCompileShader(printFShader);
-   chkcomp(printFShader,"printFShader");
-   printProg = glCreateProgram();
-   glAttachShader(printProg,printVShader);
-   glAttachShader(printProg,printFShader);
-   glLinkProgram(printProg);
-   chklink(printProg,"printProg");
+   buildProgram(&printProg,{{GL_VERTEX_SHADER,"",{printVSrc}},
+                            {GL_FRAGMENT_SHADER,"",{oitFragSrc,oitEarlySrc,printFSrc}}},"printProg");
 
      // cell spheres
-   cellVShader = glCreateShader(GL_VERTEX_SHADER);
-   glShaderSource(cellVShader,1,&cellVSrc,nullptr);
-   glCompileShader(cellVShader);
-   chkcomp(cellVShader,"cellVShader");
-
-   cellGShader = glCreateShader(GL_GEOMETRY_SHADER);
-   glShaderSource(cellGShader,1,&cellGSrc,nullptr);
-   glCompileShader(cellGShader);
-   chkcomp(cellGShader,"cellGShader");
-
-   cellFShader = glCreateShader(GL_FRAGMENT_SHADER);
-   glShaderSource(cellFShader,1,&cellFSrc,nullptr);
-   glCompileShader(cellFShader);
-   chkcomp(cellFShader,"cellFShader");
-
-   cellProg = glCreateProgram();
-   glAttachShader(cellProg,cellVShader);
-   glAttachShader(cellProg,cellGShader);
-   glAttachShader(cellProg,cellFShader);
-   glLinkProgram(cellProg);
-   chklink(cellProg,"cellProg");
-   glUseProgram(cellProg);
-   glUniform1i(5,hideCells);
-   glUniform1i(4,ptSize);
-   glUniform3fv(11,1,glm::value_ptr(amb));
-   glUniform3fv(12,1,glm::value_ptr(dif));
-   glUniform3fv(13,1,glm::value_ptr(dist));
-   glUniform1f(14,cellTrans);
-   glGenBuffers(1,&colorTabVbo);
-   glGenBuffers(1,&deltaTabVbo);
+   viewPrograms(cellProgs,CELL_VIEWS,{cellShadeSrc,lightSrc,cellVSrc},{lightSrc,cellViewSrc,cellGSrc},
+                {GL_FRAGMENT_SHADER,"",{oitFragSrc,lightSrc,oitEarlySrc,cellMeshFSrc,cellFSrc}},"cellProg");
+
+     // impostor cells, a square per cell the sphere is ray cast in, always
+     // by a geometry shader
+   string sphere_def = "#define SPHERE_RADIUS " + to_string(SPHERE_RADIUS) + "\n";
+   for (int view = 0; view < CELL_VIEWS; ++view)
+      buildProgram(&cellImpProgs[view],{{GL_VERTEX_SHADER,viewHead(GL_VERTEX_SHADER,NO_VIEW),{cellShadeSrc,cellImpVSrc}},
+                                        {GL_GEOMETRY_SHADER,viewHead(GL_GEOMETRY_SHADER,view) + sphere_def,{lightSrc,cellViewSrc,cellImpGSrc}},
+                                        {GL_FRAGMENT_SHADER,"",{oitFragSrc,lightSrc,cellImpFSrc,cellFSrc}}},"cellImpProg");
 
     // skin on outlines
-   sortVs = glCreateShader(GL_VERTEX_SHADER);
-   glShaderSource(sortVs,1,&sort_skinVSrc,nullptr);
-   glCompileShader(sortVs);
-   chkcomp(sortVs,"sortVs");
-   sortGs = glCreateShader(GL_GEOMETRY_SHADER);
-   glShaderSource(sortGs,1,&sort_skinGSrc,nullptr);
-   glCompileShader(sortGs);
-   chkcomp(sortGs,"sortGs");
-   sortFs = glCreateShader(GL_FRAGMENT_SHADER);
-   glShaderSource(sortFs,1,&sort_skinFSrc,nullptr);
-   glCompileShader(sortFs);
-   chkcomp(sortFs,"sortFs");
-
-   sort_skinProg = glCreateProgram();
-   glAttachShader(sort_skinProg,sortVs);
-   glAttachShader(sort_skinProg,sortGs);
-   glAttachShader(sort_skinProg,sortFs);
-   glLinkProgram(sort_skinProg);
-   chklink(sort_skinProg,"sort_skinProg");
-   glUseProgram(sort_skinProg);
-   glUniform1f(1,skinTrans);
-   glUniform3fv(2,1,glm::value_ptr(amb));
-   glUniform3fv(3,1,glm::value_ptr(dif));
-   glUniform3fv(4,1,glm::value_ptr(dist));
+   viewPrograms(sort_skinProgs,VIEWS,{sort_skinVSrc},{sort_skinGSrc},
+                {GL_FRAGMENT_SHADER,"",{oitFragSrc,lightSrc,oitEarlySrc,sort_skinFSrc}},"sort_skinProg");
 
       // shaders for second pass OIT rendering
-   finalRenderVs = glCreateShader(GL_VERTEX_SHADER);
-   glShaderSource(finalRenderVs,1,&finalRenderVSrc,nullptr);
-   glCompileShader(finalRenderVs);
-   chkcomp(finalRenderVs,"finalRenderVs");
-   finalRenderGs = glCreateShader(GL_GEOMETRY_SHADER);
-   glShaderSource(finalRenderGs,1,&finalRenderGSrc,nullptr);
-   glCompileShader(finalRenderGs);
-   chkcomp(finalRenderGs,"finalRenderGs");
-   finalRenderFs = glCreateShader(GL_FRAGMENT_SHADER);
-   glShaderSource(finalRenderFs,1,&finalRenderFSrc,nullptr);
-   glCompileShader(finalRenderFs);
-   chkcomp(finalRenderFs,"finalRenderFs");
-
-   finalRenderProg = glCreateProgram();
-   glAttachShader(finalRenderProg,finalRenderVs);
-   glAttachShader(finalRenderProg,finalRenderGs);
-   glAttachShader(finalRenderProg,finalRenderFs);
-   glLinkProgram(finalRenderProg);
-   chklink(finalRenderProg,"finalRenderProg");
-   glUseProgram(finalRenderProg);
-   glUniform4f(1,backColor,backColor,backColor,1.0);
-   glUseProgram(0);
+   viewPrograms(finalRenderProgs,VIEWS,{finalRenderVSrc},{finalRenderGSrc},
+                {GL_FRAGMENT_SHADER,"",{finalRenderFSrc}},"finalRenderProg");
 
-    // brain structures 
-   structVShader = glCreateShader(GL_VERTEX_SHADER);
-   glShaderSource(structVShader,1,&structVSrc,nullptr);
-   glCompileShader(structVShader);
-   chkcomp(structVShader,"structVShader");
-   structGShader = glCreateShader(GL_GEOMETRY_SHADER);
-   glShaderSource(structGShader,1,&structGSrc,nullptr);
-   glCompileShader(structGShader);
-   chkcomp(structGShader,"structGShader");
-   structFShader = glCreateShader(GL_FRAGMENT_SHADER);
-   glShaderSource(structFShader,1,&structFSrc,nullptr);
-   glCompileShader(structFShader);
-   chkcomp(structFShader,"structFShader");
-   structProg = glCreateProgram();
-   glAttachShader(structProg,structVShader);
-   glAttachShader(structProg,structGShader);
-   glAttachShader(structProg,structFShader);
-   glLinkProgram(structProg);
-   chklink(structProg,"structProg");
-   glUseProgram(structProg);
-   glUniform1f(1,regionTrans);
-   glUniform3fv(2,1,glm::value_ptr(amb));
-   glUniform3fv(3,1,glm::value_ptr(dif));
-   glUniform3fv(4,1,glm::value_ptr(dist));
+      // second pass for the weighted and peeling engines, same quad
+   viewPrograms(composeProgs,VIEWS,{finalRenderVSrc},{finalRenderGSrc},
+                {GL_FRAGMENT_SHADER,"#version 430\n#define TILE " + to_string(OIT_TILE) + "\n",{oitComposeFSrc}},"composeProg");
+   phase("programs started");
 
+     // uniform buffers (UBOs) for shared transforms and counter
+   frameRing();
    extremes();
-   outlines();
    axes();
    printBox();
    skin();
    sphere();
-   stemStructs();
    oit();
+   glGenBuffers(1,&colorTabVbo);
+   glGenBuffers(1,&deltaTabVbo);
+   phase("buffers");
+
+   finishPrograms();
+   phase("programs finished");
+   for (int view = 0; view < VIEWS; ++view)
+      glProgramUniform4fv(axesProgs[view],0,1,glm::value_ptr(axesColorVec));
+
+   linked = GL_TRUE;
+   for (GLuint prog : cellImpProgs)
+      linked = prog ? linked : GL_FALSE;
+   if (linked == GL_FALSE)
+   {
+      for (GLuint& prog : cellImpProgs)
+      {
+         glDeleteProgram(prog);
+         prog = 0;
+      }
+      emit(chatBox("Impostor cells did not build, drawing cell meshes."));
+   }
+   tileResolve = tileClassProg != 0;
+   for (int cls = TILE_SHORT; cls < TILE_CLASSES; ++cls)
+      tileResolve = tileResolve && tileSortProg[cls];
 
-   glDeleteShader(vertVShader);
-   glDeleteShader(outlineFShader);
-   glDeleteShader(axesFShader);
-   glDeleteShader(printVShader);
-   glDeleteShader(printFShader);
-   glDeleteShader(cellVShader);
-   glDeleteShader(cellGShader);
-   glDeleteShader(cellFShader);
-   glDeleteShader(sortVs);
-   glDeleteShader(sortFs);
-   glDeleteShader(sortGs);
-   glDeleteShader(structVShader);
-   glDeleteShader(structFShader);
-   glDeleteShader(finalRenderVs);
-   glDeleteShader(finalRenderGs);
-   glDeleteShader(finalRenderFs);
+   cellLoader();
+   phase("cell loader");
+
+   if (Debug)
+   {
+      msg.clear();
+      QTextStream(&msg) << "Startup: " << phases;
+      if (!shaderCache.isEmpty())
+         QTextStream(&msg) << cachedPrograms << " programs from " << shaderCache << ", ";
+      QTextStream(&msg) << builtPrograms << " compiled" << endl;
+      emit(chatBox(msg));
+   }
 }
 
 // callback from driver with sometimes useful info
@@ -495,7 +467,7 @@ void BrainStemGL::mouseMoveEvent(QMouseEvent *event)
          view_rotz -= 360.0;
       else if (view_rotz <= -360.0)
          view_rotz += 360.0;
-      update();
+      sceneUpdate();
    }
    else if(buttons & Qt::LeftButton)
    {
@@ -509,13 +481,13 @@ void BrainStemGL::mouseMoveEvent(QMouseEvent *event)
          view_roty -= 360.0;
       else if (view_roty <= -360.0)
          view_roty += 360.0;
-      update();
+      sceneUpdate();
    }
    else if(buttons & Qt::RightButton)
    {
       view_trx += (float) 0.05f * diffx;
       view_try -= (float) 0.05f * diffy;
-      update();
+      sceneUpdate();
    }
 //   QString msg;
 //   QTextStream(&msg) << "X angle: " << view_rotx << "  Y angle: " << view_roty << " Z angle: " << view_rotz << endl;
@@ -544,7 +516,7 @@ void BrainStemGL::wheelEvent(QWheelEvent *event)
    int h = geometry().height();
    resizeGL(w,h);
    doneCurrent();
-   update();
+   sceneUpdate();
    event->accept();
 }
 
@@ -652,6 +624,7 @@ void BrainStemGL::axes()
    glBindVertexArray(0);
 }
 
+// The outlines and their programs, made the first time they're shown
 void BrainStemGL::outlines()
 {
    vector<GLfloat> allpts;
@@ -661,7 +634,10 @@ void BrainStemGL::outlines()
    int pt;
    float (*curr_plate)[3];
    int idx = 0;
+   QElapsedTimer timer;
 
+   timer.start();
+   viewPrograms(outlineProgs,VIEWS,{vertexVSrc},{vertexGSrc},{GL_FRAGMENT_SHADER,"",{outlineFSrc}},"outlineProg");
    for (count = 1; count < int(num_plates); ++count)
    {
       curr_plate = plate[count];
@@ -693,9 +669,21 @@ void BrainStemGL::outlines()
    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER,outlinesIdx);
    glBufferData(GL_ELEMENT_ARRAY_BUFFER,index.size()*sizeof(GLuint),index.data(),GL_STATIC_DRAW);
 
+   glBindVertexArray(0);
+
+   finishPrograms();
+   for (GLuint prog : outlineProgs)
+      glProgramUniform4fv(prog,0,1,glm::value_ptr(outlineColorVal));
+
    err_chk = glGetError();
    if (err_chk != 0)
       cout << "outlines error 2 is: " << err_chk << endl;
+   if (Debug)
+   {
+      QString msg;
+      QTextStream(&msg) << "Outlines made in " << timer.elapsed() << " ms" << endl;
+      emit(chatBox(msg));
+   }
 }
 
 void BrainStemGL::printInfo(QString& info)
@@ -758,7 +746,7 @@ void BrainStemGL::printInfo(QString& info)
    glBindTexture(GL_TEXTURE_2D,0);
    glUseProgram(0);
    doneCurrent();
-   update();
+   colorUpdate();
 }
 
 
@@ -791,7 +779,7 @@ void BrainStemGL::clearInfo()
    glUseProgram(0);
    doneCurrent();
    printClear = true;
-   update();
+   cellsUpdate();
 }
 
 // A rectangle that we draw an image on as a texture.
@@ -888,7 +876,8 @@ void BrainStemGL::skin()
 }
 
 
-// Set up the brainstem structures
+// Set up the brainstem structures and their programs, the first time
+// one is shown
 void BrainStemGL::stemStructs()
 {
    float (*curr_obj)[3];
@@ -897,7 +886,11 @@ void BrainStemGL::stemStructs()
    vector<GLfloat> norms;
    int count, obj_count, num_bytes;
    int pt;
-   oneStruct curr_offset;
+   QElapsedTimer timer;
+
+   timer.start();
+   viewPrograms(structProgs,VIEWS,{structVSrc},{structGSrc},
+                {GL_FRAGMENT_SHADER,"",{oitFragSrc,lightSrc,oitEarlySrc,structFSrc}},"structProg");
 
    if (numStructs != numNormStructs)
       cout << "Warning Structure vertices and norms are different lengths" << endl;
@@ -906,10 +899,7 @@ void BrainStemGL::stemStructs()
    {
       curr_obj = allStructs[count];
       curr_norm = objNorms[count];
-      curr_offset.first = objSizes[count][0];
-      curr_offset.count = objSizes[count][1];
-      selStructs.push_back(curr_offset);
-      obj_count = curr_offset.count;
+      obj_count = selStructs[count].count;
 
       for (pt = 0; pt < obj_count; ++pt)
       {
@@ -946,27 +936,75 @@ void BrainStemGL::stemStructs()
    glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, 0, nullptr);
    glEnableVertexAttribArray(1);
 
+   glBindVertexArray(0);
+
+   finishPrograms();
+
    err_chk = glGetError();
    if (err_chk != 0)
       cout << "stemstruct 2 is: " << err_chk << endl;
+   if (Debug)
+   {
+      QString msg;
+      QTextStream(&msg) << "Structures made in " << timer.elapsed() << " ms" << endl;
+      emit(chatBox(msg));
+   }
 }
 
-// Create array of sphere vertices and normals for vaos later
+// Create the sphere meshes for cells and their vbos, for vaos later. Each
+// level of detail is the last one with every triangle split in 4 and the
+// new corners pushed out to the sphere. The cull pass picks one per cell.
 void BrainStemGL::sphere()
 {
-   int pt;
-
-   if (numsphereVert != numsphereNorm)
-      cout << "Error:  sphere pts and norms not the same, continuing anyway" << endl;
-
-   for (pt = 0; pt < numsphereVert; ++pt)
+   const float t = (1.0 + sqrt(5.0)) / 2.0;
+   const glm::vec3 corners[] = {{-1,t,0}, {1,t,0}, {-1,-t,0}, {1,-t,0},
+                                {0,-1,t}, {0,1,t}, {0,-1,-t}, {0,1,-t},
+                                {t,0,-1}, {t,0,1}, {-t,0,-1}, {-t,0,1}};
+   const int faces[][3] = {{0,11,5}, {0,5,1}, {0,1,7}, {0,7,10}, {0,10,11},
+                           {1,5,9}, {5,11,4}, {11,10,2}, {10,7,6}, {7,1,8},
+                           {3,9,4}, {3,4,2}, {3,2,6}, {3,6,8}, {3,8,9},
+                           {4,9,5}, {2,4,11}, {6,2,10}, {8,6,7}, {9,8,1}};
+   ptCoords tris, split;
+   int lod;
+   size_t tri;
+
+   for (auto& face : faces)
+      for (int corner : face)
+         tris.push_back(glm::normalize(corners[corner]));
+   for (lod = 0; lod < SPHERE_LODS; ++lod)
    {
-      sphereV.push_back(glm::vec3(sphereVert[pt][0],sphereVert[pt][1],sphereVert[pt][2]));
+      sphereFirst[lod] = sphereV.size();
+      sphereCount[lod] = tris.size();
+      for (auto& pt : tris)
+      {
+         sphereV.push_back(pt * SPHERE_RADIUS);
+         sphereN.push_back(pt);
+      }
+      split.clear();
+      for (tri = 0; lod < SPHERE_LODS - 1 && tri < tris.size(); tri += 3)
+      {
+         glm::vec3 a = tris[tri], b = tris[tri+1], c = tris[tri+2];
+         glm::vec3 ab = glm::normalize(a + b);
+         glm::vec3 bc = glm::normalize(b + c);
+         glm::vec3 ca = glm::normalize(c + a);
+         split.insert(split.end(),{a,ab,ca, ab,b,bc, ca,bc,c, ab,bc,ca});
+      }
+      tris.swap(split);
    }
-   sphereSize = sphereV.size();
 
-   for (pt = 0; pt < numsphereNorm; ++pt)
-      sphereN.push_back(glm::vec3(sphereNorm[pt][0],sphereNorm[pt][1],sphereNorm[pt][2]));
+     // every cell vao uses these
+   glGenBuffers(1,&sphereVertVbo);
+   glBindBuffer(GL_ARRAY_BUFFER,sphereVertVbo);
+   glBufferData(GL_ARRAY_BUFFER,sphereV.size()*sizeof(glm::vec3),sphereV.data(),GL_STATIC_DRAW);
+   glGenBuffers(1,&sphereNormVbo);
+   glBindBuffer(GL_ARRAY_BUFFER,sphereNormVbo);
+   glBufferData(GL_ARRAY_BUFFER,sphereN.size()*sizeof(glm::vec3),sphereN.data(),GL_STATIC_DRAW);
+   glBindBuffer(GL_ARRAY_BUFFER,0);
+
+     // The cull pass. Without it every cell is drawn, meshes at the finest level.
+   string defs = "#version 430\n#define SPHERE_LODS " + to_string(SPHERE_LODS)
+               + "\n#define LOD_GROUP " + to_string(LOD_GROUP) + "\n";
+   buildProgram(&cellCullProg,{{GL_COMPUTE_SHADER,defs,{cellShadeSrc,cellCullCSrc}}},"cellCullProg");
 }
 
 // Set up fragment linked lists for Order Independent Transparency sorting
@@ -975,40 +1013,47 @@ void BrainStemGL::oit()
 {
    GLenum err_chk = glGetError();
 
-    // Atomic counter
-   glGenBuffers(1, &atomicCounterBuff);
-   glBindBuffer(GL_ATOMIC_COUNTER_BUFFER, atomicCounterBuff);
-   glBufferData(GL_ATOMIC_COUNTER_BUFFER, sizeof(GLuint), nullptr, GL_DYNAMIC_DRAW);
+    // Atomic counter lives in the frame ring, see frameRing()
 
-    // don't overflow linked list buff
-   GLuint maxCap = MAX_OIT_NODES * OIT_NODE_SIZE;
+    // don't overflow linked list buff, oitPool() sets the node count
    glGenBuffers(1,&nodeUbo);
    glBindBufferBase(GL_UNIFORM_BUFFER,nodeUboBlkId,nodeUbo);
-   glBufferData(GL_UNIFORM_BUFFER, sizeof(maxCap), &maxCap, GL_STATIC_DRAW);
+   glBufferData(GL_UNIFORM_BUFFER, sizeof(oitNodes), &oitNodes, GL_DYNAMIC_DRAW);
 
       // for debugging, shaders keep track of max nodes
 //   glGenBuffers(1,&nodeCount);
 //   glBindBufferBase(GL_SHADER_STORAGE_BUFFER,nodeId,nodeCount);
 //   glBufferData(GL_UNIFORM_BUFFER, sizeof(GLuint), null, GL_DYNAMIC_DRAW);
 
-     // Head pointer buffer, one item for screen w & h. This is the start of the OIT
-     // linked lists. 
-   glGenTextures(1, &headPointerTex);
-   glActiveTexture(GL_TEXTURE0);
-   glBindTexture(GL_TEXTURE_2D, headPointerTex);
-   glTexStorage2D(GL_TEXTURE_2D, 1, GL_R32UI, MAX_FB_WIDTH, MAX_FB_HEIGHT);
-   glBindImageTexture(0, headPointerTex, 0, GL_FALSE, 0, GL_READ_WRITE, GL_R32UI);
-
-    // Linked list storage buffer, head pointers above point to lists in this
+     // Head pointers, the start of the OIT linked lists, are sized for the
+     // window in resizeGL, see oitHeads(). The kept lists of the static layer
+     // have their own, see staticLayer().
+   glGenBuffers(1, &staticCountBuff);
+   glBindBuffer(GL_COPY_WRITE_BUFFER, staticCountBuff);
+   glBufferData(GL_COPY_WRITE_BUFFER, sizeof(GLuint), nullptr, GL_DYNAMIC_COPY);
+   glBindBuffer(GL_COPY_WRITE_BUFFER, 0);
+
+    // Linked list storage buffer, head pointers above point to lists in this.
+    // It is sized for the window in resizeGL.
+   glGetInteger64v(GL_MAX_SHADER_STORAGE_BLOCK_SIZE,&maxOitNodes);
+   maxOitNodes /= OIT_NODE_SIZE;
    glGenBuffers(1, &linkedListBuff);
    glBindBufferBase(GL_SHADER_STORAGE_BUFFER, 0, linkedListBuff);
-   glBufferData(GL_SHADER_STORAGE_BUFFER, MAX_OIT_NODES * OIT_NODE_SIZE, nullptr, GL_DYNAMIC_DRAW);
 
-    // Buffer for (re)initing the head pointer texture
-   vector <GLuint> initValue(MAX_FB_WIDTH*MAX_FB_HEIGHT,0xFFFFFFFF);
-   glGenBuffers(1, &headPointerInitVal);
-   glBindBuffer(GL_PIXEL_UNPACK_BUFFER, headPointerInitVal);
-   glBufferData(GL_PIXEL_UNPACK_BUFFER, initValue.size()*sizeof(GLuint), &initValue[0], GL_STATIC_COPY);
+    // Each frame the head pointers the window covers are reset, by the driver
+    // if it can clear textures (4.4), otherwise by a compute shader.
+   if (context()->hasExtension(QByteArrayLiteral("GL_ARB_clear_texture")))
+      clearTexSubImage = reinterpret_cast<PFNGLCLEARTEXSUBIMAGEPROC>(context()->getProcAddress("glClearTexSubImage"));
+   if (!clearTexSubImage)
+      buildProgram(&headClearProg,{{GL_COMPUTE_SHADER,"",{headClearCSrc}}},"headClearProg");
+
+    // The list engine's compute resolve and its tile bins, what it writes
+    // is made with the head pointers. The fragment resolve is the fallback
+    // if it won't build.
+   glGenBuffers(1,&tileBinBuff);
+   glBindBufferBase(GL_SHADER_STORAGE_BUFFER,6,tileBinBuff);
+   glBufferData(GL_SHADER_STORAGE_BUFFER,sizeof(GLuint)*TILE_CLASSES*(3+TILE_BINS),nullptr,GL_DYNAMIC_DRAW);
+   tilePrograms();
 
      // Rect we use to get pixel (x,y) values from while rendering sorted vertices
    glGenVertexArrays(1, &showVao);
@@ -1020,6 +1065,11 @@ void BrainStemGL::oit()
    glEnableVertexAttribArray(0);
    glClearDepthf(1.0f);
 
+     // The weighted and peeling engines draw into their own targets,
+     // oitTargets() makes the ones the engine in use needs.
+   glGenFramebuffers(1,&oitFbo);
+   glGenQueries(PEEL_PASSES,peelQuery);
+
    glBindVertexArray(0);            // nothing in scope
    glBindTexture(GL_TEXTURE_2D,0);
    glBindBuffer(GL_SHADER_STORAGE_BUFFER, 0);
@@ -1029,397 +1079,1125 @@ void BrainStemGL::oit()
       cout << "oit error is: " << err_chk << endl;
 }
 
-// Time to update the cells.
-// Two cases
-//   new file - clear all the old stuff out and build new gl stuff
-//   on_off  -   only show selected on_off_vals
-void BrainStemGL::updateCells(bool new_file, bool exp_chg, bool delta_cths, 
-                 vector<int>& on_off_vals, vector<int>& exp_on_off, 
-                 cellArray& dispCells, ClustRGB& rgbClustMap, bool have_phrenic)
-{
-   int curr_bin, curr_clust, coloridx;
-   size_t rows;
-   GLuint  newVao;
-   size_t  c_coord_bytes, s_coord_bytes, d_coord_bytes;
-   size_t  csib_coord_bytes, ssib_coord_bytes;
-   size_t  c_color_bytes, s_color_bytes, d_color_bytes;
-   size_t  csib_color_bytes, ssib_color_bytes;
-   size_t set;
-   size_t tot_vaos;
-   double normval;
-   double deltaval;
-   ptCoords triangles;
-   ptCoords norms;
-   int num_sphere_bytes;
-   array <ptCoords,NUM_PT_LISTS> cthCoords; 
-   array <colorIdx,NUM_CELL_COLORS> cthColorIdx;
-   CTHIter cthiter;
-   CellIter citer, citerctl, citerstim, citerdelta;
-   CellIter citerctlsib, citerstimsib;
-   bool have_ctl = false;
-   bool have_stim = false;
-   bool have_ctrlsibs = false;
-   bool have_stimsibs = false;
-   ClusterIter cell;
+// Size the OIT node pool for the framebuffer, enough for oitDepth fragments
+// per pixel on average. The shaders drop fragments past the end.
+void BrainStemGL::oitPool(int width, int height)
+{
    GLenum err_chk;
-   GLuint sphere_pt_vbo, sphere_norm_vbo;
-   GLuint ctl_pt_vbo, ctl_color_vbo;
-   GLuint stim_pt_vbo, stim_color_vbo;
-   GLuint delta_pt_vbo, delta_color_vbo;
-   GLuint csib_pt_vbo, csib_color_vbo, ssib_pt_vbo, ssib_color_vbo;
-   QString msg;
-   int num_clusts = on_off_vals.size();
+   double dpr = devicePixelRatioF();
+   GLint64 nodes = GLint64(width*dpr) * GLint64(height*dpr) * oitDepth;
 
-   haveDelta = delta_cths;
-   onOff = on_off_vals;
-   havePhrenic = have_phrenic;
-   if (haveDelta)              // add fake checkbox at end for delta CTHs
-      onOff.push_back(true);
-   c_coord_bytes=s_coord_bytes=d_coord_bytes=csib_coord_bytes=ssib_coord_bytes=0;
-   c_color_bytes=s_color_bytes=d_color_bytes=csib_color_bytes=ssib_color_bytes=0;
+   if (!linkedListBuff)   // no context yet
+      return;
+   if (oitEngine != OIT_LISTS && oitEngine != OIT_KBUFFER)   // no lists
+      nodes = 1;
+   else
+      nodes = max(nodes,oitGrown);   // what overflows have needed
+   nodes = max(min(nodes,maxOitNodes),GLint64(1));
+   if (GLuint(nodes) == oitNodes)
+      return;
+   oitNodes = nodes;
+   staticStale = true;      // the kept nodes are gone
+   listsStale = true;       // and so are the frame's, don't just recolor them
+   glBindBuffer(GL_SHADER_STORAGE_BUFFER, linkedListBuff);
+   glBufferData(GL_SHADER_STORAGE_BUFFER, GLsizeiptr(oitNodes) * OIT_NODE_SIZE, nullptr, GL_DYNAMIC_DRAW);
+   glBindBuffer(GL_SHADER_STORAGE_BUFFER, 0);
+   glBindBuffer(GL_UNIFORM_BUFFER, nodeUbo);
+   glBufferSubData(GL_UNIFORM_BUFFER, 0, sizeof(oitNodes), &oitNodes);
+   glBindBuffer(GL_UNIFORM_BUFFER, 0);
 
-   if (new_file || exp_chg) // must (re) build vaos 
+   if (Debug)
    {
-      clearInfo();
-      makeCurrent();         // operate in current GL context
-      clearClusts();
-      createShades(rgbClustMap);
-      updateCellProg();
+      QString msg;
+      QTextStream(&msg) << "OIT node pool: " << oitNodes << " nodes, " 
+                        << (GLuint64(oitNodes) * OIT_NODE_SIZE) / (1024*1024) << " MB";
+      emit(chatBox(msg));
+   }
 
-         // If we get this far, at least one list has cells. Get # bins.
-         // We currently only support files with just control periods,
-         // or ctl/stim periods for one type of stim. We assume the loader
-         // has checked for this and will not call us if there are no 
-         // or too many periods. Delta, ctrlsib and stimsib lists are
-         // created synthetically.
-      int ctl_bins = 0;
-      int stim_bins = 0;
-      if (dispCells[CONTROL_COLORS].size())
-         have_ctl = true;
-      if (dispCells[STIM_COLORS].size())
-         have_stim = true;
-      if (dispCells[CTRLSIB_COLORS].size())
-         have_ctrlsibs = true;
-      if (dispCells[STIMSIB_COLORS].size())
-         have_stimsibs = true;
+   err_chk = glGetError();
+   if (err_chk != 0)
+      cout << "oit pool error is: " << err_chk << endl;
+}
 
-      if (have_ctl)
-      {
-         citer = dispCells[CONTROL_COLORS].begin();
-         if (citer != dispCells[CONTROL_COLORS].end())
-            ctl_bins = citer->second.begin()->normCth.size();
-      }
-      if (have_stim) 
-      {
-         citer = dispCells[STIM_COLORS].begin();
-         if (citer != dispCells[STIM_COLORS].end())
-            stim_bins = citer->second.begin()->normCth.size();
-      }
-   
-      numBins = max(ctl_bins,stim_bins);  // really should be same if we have both
-      tot_vaos = numBins+1;  // 1 vao for base color and bins (if any)
-      currCycle = 0;
-      if (numBins)
-         phrenicStep = double(PHRENIC_E_END - PHRENIC_I_START)/numBins;
-      else
-         phrenicStep = 0;
+// Size the head pointers, the static layer's copy of them, and what the
+// compute resolve writes for the framebuffer. They only grow, so going
+// between mono and stereo or shrinking the window doesn't make them again.
+void BrainStemGL::oitHeads(int width, int height)
+{
+   GLenum err_chk;
+   double dpr = devicePixelRatioF();
+   GLsizei w = min(GLsizei(width*dpr),GLsizei(MAX_FB_WIDTH));
+   GLsizei h = min(GLsizei(height*dpr),GLsizei(MAX_FB_HEIGHT));
 
-        // sphere object global to all cell VAOs
-      num_sphere_bytes = sphereSize * sizeof(glm::vec3);
-      glGenBuffers(1,&sphere_pt_vbo);
-      glBindBuffer(GL_ARRAY_BUFFER,sphere_pt_vbo);
-      glBufferData(GL_ARRAY_BUFFER,num_sphere_bytes,sphereV.data(),GL_STATIC_DRAW);
-       // normals for sphere
-      glGenBuffers(1,&sphere_norm_vbo);
-      glBindBuffer(GL_ARRAY_BUFFER,sphere_norm_vbo);
-      glBufferData(GL_ARRAY_BUFFER,num_sphere_bytes,sphereN.data(),GL_STATIC_DRAW);
+   if (!linkedListBuff)   // no context yet
+      return;
+   if (w <= headTexW && h <= headTexH)
+      return;
+   if (headPointerTex)
+   {
+      glDeleteTextures(1,&headPointerTex);
+      glDeleteTextures(1,&staticHeadTex);
+      glDeleteTextures(1,&resolveTex);
+      glDeleteTextures(1,&tileUsedTex);
+   }
+   headTexW = max(w,headTexW);
+   headTexH = max(h,headTexH);
+   staticStale = true;      // the kept head pointers are gone
 
-      for (curr_clust = 0; curr_clust < num_clusts; ++curr_clust)
-      {
-         for (int cells=CONTROL_PTS; cells < NUM_PT_LISTS; ++cells)
-            cthCoords[cells].clear();
-         for (int cells=CONTROL_COLORS; cells < NUM_CELL_COLORS; ++cells)
-         {
-            cthColorIdx[cells].clear();
-            cthColorIdx[cells].resize(numBins+1);
-         }
-           // Collect cell info and build pts, color list and color cycling
-           // lists if we have bins.
-           // For all pts in current cluster make pt & primary color lists
-         if (have_ctl)
-         {
-              // not all periods are in every cluster, so check for this
-            citerctl = dispCells[CONTROL_COLORS].find(curr_clust);
-            if (citerctl != dispCells[CONTROL_COLORS].end())
-            {
-               for (cell=citerctl->second.begin(); cell != citerctl->second.end(); ++cell)
-               {
-                      // some cells don't have stereotaxic coords.  If at origin,
-                      // it is one of those cells. Don't draw it.
-                  if ( cell->rl == 0.0 && cell->dp == 0.0 && cell->ap == 0.0)
-                     continue;
-                   // if we have experiment(s), is this cell in a selected experiment(s)
-                  if ((exp_on_off.size() == 0) || exp_on_off[cell->expidx])
-                  {
-                     cthCoords[CONTROL_PTS].push_back(glm::vec3(cell->rl, -cell->dp, -cell->ap));
-                       // index of brightest color for this cluster
-                     cthColorIdx[CONTROL_COLORS][0].push_back(cell->coloridx*COLOR_STEPS);
-                  }
-               }
-                  // optional bin colors
-               for (curr_bin=0,rows = 1; rows <= numBins; ++curr_bin,++rows)
-               {
-                  for (ClusterIter normiter=citerctl->second.begin(); normiter != citerctl->second.end(); ++normiter)
-                  {
-                     normval = normiter->normCth[curr_bin];
-                     coloridx = floor((COLOR_STEPS-1) - (normval*(COLOR_STEPS-1)));
-                     if (coloridx >= COLOR_STEPS) // handle zero case
-                         coloridx = COLOR_STEPS-1;
-                     coloridx += COLOR_STEPS * normiter->coloridx; // offset into table
-                     cthColorIdx[CONTROL_COLORS][rows].push_back(coloridx);
-                  }
-               }
-            }
-         }
+   glActiveTexture(GL_TEXTURE0);
+   glGenTextures(1,&headPointerTex);
+   glBindTexture(GL_TEXTURE_2D,headPointerTex);
+   glTexStorage2D(GL_TEXTURE_2D,1,GL_R32UI,headTexW,headTexH);
+   glBindImageTexture(0,headPointerTex,0,GL_FALSE,0,GL_READ_WRITE,GL_R32UI);
+   glGenTextures(1,&staticHeadTex);
+   glBindTexture(GL_TEXTURE_2D,staticHeadTex);
+   glTexStorage2D(GL_TEXTURE_2D,1,GL_R32UI,headTexW,headTexH);
+   glGenTextures(1,&resolveTex);
+   glBindTexture(GL_TEXTURE_2D,resolveTex);
+   glTexStorage2D(GL_TEXTURE_2D,1,GL_RGBA8,headTexW,headTexH);
+   glBindImageTexture(1,resolveTex,0,GL_FALSE,0,GL_WRITE_ONLY,GL_RGBA8);
+   glGenTextures(1,&tileUsedTex);
+   glBindTexture(GL_TEXTURE_2D,tileUsedTex);
+   glTexStorage2D(GL_TEXTURE_2D,1,GL_R8,(headTexW+OIT_TILE-1)/OIT_TILE,(headTexH+OIT_TILE-1)/OIT_TILE);
+   glBindImageTexture(2,tileUsedTex,0,GL_FALSE,0,GL_WRITE_ONLY,GL_R8);
+   glBindTexture(GL_TEXTURE_2D,0);
 
-         if (have_stim)
-         {
-            citerstim = dispCells[STIM_COLORS].find(curr_clust);
-            if (citerstim != dispCells[STIM_COLORS].end())
-            {
-                // do STIM period coords & colors
-               for (cell=citerstim->second.begin(); cell != citerstim->second.end(); ++cell)
-               {
-                  if (cell->rl == 0.0 && cell->dp == 0.0 && cell->ap == 0.0)
-                     continue;
-                  if ((exp_on_off.size() == 0) || exp_on_off[cell->expidx])
-                  {
-                     cthCoords[STIM_PTS].push_back(glm::vec3(cell->rl, -cell->dp, -cell->ap));
-                     cthColorIdx[STIM_COLORS][0].push_back(cell->coloridx*COLOR_STEPS); 
-                  }
-               }
-               for (curr_bin=0,rows = 1; rows <= numBins; ++curr_bin,++rows)
-               {
-                  for (ClusterIter deltaiter=citerstim->second.begin(); deltaiter != citerstim->second.end(); ++deltaiter)
-                  {
-                     deltaval = deltaiter->normCth[curr_bin];
-                     coloridx = floor((COLOR_STEPS-1) - (deltaval*(COLOR_STEPS-1)));
-                     if (coloridx >= COLOR_STEPS) // handle zero case
-                         coloridx = COLOR_STEPS-1;
-                     coloridx += COLOR_STEPS * deltaiter->coloridx; // offset into table
-                     cthColorIdx[STIM_COLORS][rows].push_back(coloridx);
-                  }
-               }
-            }
-         }
+   err_chk = glGetError();
+   if (err_chk != 0)
+      cout << "oit heads error is: " << err_chk << endl;
+}
 
-         if (have_ctrlsibs)
-         {
-             // ctrl -> stim sib
-            citerctlsib = dispCells[CTRLSIB_COLORS].find(curr_clust);
-            if (citerctlsib != dispCells[CTRLSIB_COLORS].end())
-            {
-               for (cell=citerctlsib->second.begin(); cell != citerctlsib->second.end(); ++cell)
-               {
-                  if (cell->rl == 0.0 && cell->dp == 0.0 && cell->ap == 0.0)
-                     continue;
-                  if ((exp_on_off.size() == 0) || exp_on_off[cell->expidx])
-                  {
-                     cthCoords[CTRLSIB_PTS].push_back(glm::vec3(cell->rl, -cell->dp, -cell->ap));
-                       // index of brightest color for this cluster
-                     cthColorIdx[CTRLSIB_COLORS][0].push_back(cell->coloridx*COLOR_STEPS);
-                  }
-               }
-                  // optional bin colors
-               for (curr_bin=0,rows = 1; rows <= numBins; ++curr_bin,++rows)
-               {
-                  for (ClusterIter normiter=citerctlsib->second.begin(); normiter != citerctlsib->second.end(); ++normiter)
-                  {
-                     normval = normiter->normCth[curr_bin];
-                     coloridx = floor((COLOR_STEPS-1) - (normval*(COLOR_STEPS-1)));
-                     if (coloridx >= COLOR_STEPS) // handle zero case
-                         coloridx = COLOR_STEPS-1;
-                     coloridx += COLOR_STEPS * normiter->coloridx; // offset into table
-                     cthColorIdx[CTRLSIB_COLORS][rows].push_back(coloridx);
-                  }
-               }
-            }
-         }
+// Set the head pointers the window covers to end of list
+void BrainStemGL::clearHeads()
+{
+   const GLuint empty = 0xFFFFFFFF;
+   double dpr = devicePixelRatioF();
+   GLsizei w = min(GLsizei(geometry().width()*dpr),GLsizei(MAX_FB_WIDTH));
+   GLsizei h = min(GLsizei(geometry().height()*dpr),GLsizei(MAX_FB_HEIGHT));
 
-         if (have_stimsibs)
-         {
-             // stim -> ctrl sib
-            citerstimsib = dispCells[STIMSIB_COLORS].find(curr_clust);
-            if (citerstimsib != dispCells[STIMSIB_COLORS].end())
-            {
-               for (cell=citerstimsib->second.begin(); cell != citerstimsib->second.end(); ++cell)
-               {
-                  if (cell->rl == 0.0 && cell->dp == 0.0 && cell->ap == 0.0)
-                     continue;
-                  if ((exp_on_off.size() == 0) || exp_on_off[cell->expidx])
-                  {
-                     cthCoords[STIMSIB_PTS].push_back(glm::vec3(cell->rl, -cell->dp, -cell->ap));
-                     cthColorIdx[STIMSIB_COLORS][0].push_back(cell->coloridx*COLOR_STEPS);
-                  }
-               }
-                  // optional bin colors
-               for (curr_bin=0,rows = 1; rows <= numBins; ++curr_bin,++rows)
-               {
-                  for (ClusterIter normiter=citerstimsib->second.begin(); normiter != citerstimsib->second.end(); ++normiter)
-                  {
-                     normval = normiter->normCth[curr_bin];
-                     coloridx = floor((COLOR_STEPS-1) - (normval*(COLOR_STEPS-1)));
-                     if (coloridx >= COLOR_STEPS) // handle zero case
-                         coloridx = COLOR_STEPS-1;
-                     coloridx += COLOR_STEPS * normiter->coloridx; // offset into table
-                     cthColorIdx[STIMSIB_COLORS][rows].push_back(coloridx);
-                  }
-               }
-            }
-         }
+   if (clearTexSubImage)
+      clearTexSubImage(headPointerTex,0,0,0,0,w,h,1,GL_RED_INTEGER,GL_UNSIGNED_INT,&empty);
+   else
+   {
+      glUseProgram(headClearProg);
+      glUniform2i(0,w,h);
+      glDispatchCompute((w+HEAD_CLEAR_GROUP-1)/HEAD_CLEAR_GROUP,(h+HEAD_CLEAR_GROUP-1)/HEAD_CLEAR_GROUP,1);
+      glMemoryBarrier(GL_SHADER_IMAGE_ACCESS_BARRIER_BIT);
+   }
+}
 
-            // generate a [pt list] [ color list] so we have a total of
-            // at least one list if no CTH data, OR 1 for each bin
-            // total # of VAOs for this cluster is # of cths
-         err_chk = glGetError(); // clear errors
+// Make the render targets the transparency engine needs, sized for the
+// framebuffer. The list engine just keeps a copy of the opaque pass, both
+// list engines a copy of its depth. The k-buffer's resolve is built the
+// first time it's picked. Nothing is remade if the size and engine match.
+void BrainStemGL::oitTargets(int width, int height)
+{
+   GLenum err_chk, status;
+   GLenum formats[OIT_TARGETS];
+   int targets = 0, target;
+   double dpr = devicePixelRatioF();
+   GLsizei w = min(GLsizei(width*dpr),GLsizei(MAX_FB_WIDTH));
+   GLsizei h = min(GLsizei(height*dpr),GLsizei(MAX_FB_HEIGHT));
 
-         if (have_ctl)
-         {
-            c_coord_bytes = cthCoords[CONTROL_PTS].size() * sizeof(glm::vec3); 
-            c_color_bytes = cthColorIdx[CONTROL_COLORS][0].size() * sizeof(coloridx);
-         }
+   if (!oitFbo)   // no context yet
+      return;
+   if (w == oitTexW && h == oitTexH && oitEngine == oitTexEngine)
+      return;
+   if (oitTex[0])
+   {
+      glDeleteTextures(OIT_TARGETS,oitTex);
+      fill(oitTex,oitTex+OIT_TARGETS,0);
+   }
+   if (oitDepthTex)     // the k-buffer has only this one
+   {
+      glDeleteTextures(1,&oitDepthTex);
+      oitDepthTex = 0;
+   }
+   oitTexW = w;
+   oitTexH = h;
+   oitTexEngine = oitEngine;
+   if (oitEngine == OIT_LISTS)
+   {
+      formats[LIST_OPAQUE] = GL_RGBA8;
+      targets = 1;
+   }
+   else if (oitEngine == OIT_KBUFFER)   // just the depth, for impostors
+   {
+      if (!kBufferProgs[MONO_VIEW])
+         kBufferProgram();
+      targets = 0;
+   }
+   else if (oitEngine == OIT_WEIGHTED)
+   {
+      formats[WB_ACCUM] = GL_RGBA16F;
+      formats[WB_REVEAL] = GL_R8;
+      targets = 2;
+   }
+   else if (oitEngine == OIT_PEEL)
+   {
+      formats[PEEL_DEPTH] = formats[PEEL_DEPTH+1] = GL_RG32F;
+      formats[PEEL_FRONT] = GL_RGBA8;
+      formats[PEEL_BACK] = formats[PEEL_BACK+1] = GL_RGBA8;
+      formats[PEEL_BLEND] = GL_RGBA8;
+      targets = OIT_TARGETS;
+   }
+   else
+      return;
 
-         if (have_stim)
-         {
-            s_coord_bytes = cthCoords[STIM_PTS].size() * sizeof(glm::vec3); 
-            s_color_bytes = cthColorIdx[STIM_COLORS][0].size() * sizeof(coloridx);
-         }
+   glBindFramebuffer(GL_FRAMEBUFFER,oitFbo);
+   glGenTextures(targets,oitTex);
+   for (target = 0; target < targets; ++target)
+   {
+      glBindTexture(GL_TEXTURE_2D,oitTex[target]);
+      glTexStorage2D(GL_TEXTURE_2D,1,formats[target],w,h);
+      glFramebufferTexture(GL_FRAMEBUFFER,GL_COLOR_ATTACHMENT0+target,oitTex[target],0);
+   }
+     // same format as the widget's, so the opaque depth can be blitted in
+   glGenTextures(1,&oitDepthTex);
+   glBindTexture(GL_TEXTURE_2D,oitDepthTex);
+   glTexStorage2D(GL_TEXTURE_2D,1,GL_DEPTH24_STENCIL8,w,h);
+   glFramebufferTexture(GL_FRAMEBUFFER,GL_DEPTH_STENCIL_ATTACHMENT,oitDepthTex,0);
+   glBindTexture(GL_TEXTURE_2D,0);
 
-         if (have_ctrlsibs)
-         {
-            csib_coord_bytes = cthCoords[CTRLSIB_PTS].size() * sizeof(glm::vec3); 
-            csib_color_bytes = cthColorIdx[CTRLSIB_COLORS][0].size() * sizeof(coloridx);
-         }
-         if (have_stimsibs)
-         {
-            ssib_coord_bytes = cthCoords[STIMSIB_PTS].size() * sizeof(glm::vec3); 
-            ssib_color_bytes = cthColorIdx[STIMSIB_COLORS][0].size() * sizeof(coloridx);
-         }
+   status = glCheckFramebufferStatus(GL_FRAMEBUFFER);
+   glBindFramebuffer(GL_FRAMEBUFFER,defaultFramebufferObject());
+   if (status != GL_FRAMEBUFFER_COMPLETE && (oitEngine == OIT_LISTS || oitEngine == OIT_KBUFFER))
+   {
+      emit(chatBox("Can't keep a copy of the opaque pass, color cycling redraws everything and cells are meshes."));
+      glDeleteTextures(OIT_TARGETS,oitTex);
+      glDeleteTextures(1,&oitDepthTex);
+      fill(oitTex,oitTex+OIT_TARGETS,0);
+      oitDepthTex = 0;
+   }
+   else if (status != GL_FRAMEBUFFER_COMPLETE)
+   {
+      QString msg;
+      QTextStream(&msg) << "Transparency targets incomplete (" << status << "), using per-pixel lists.";
+      emit(chatBox(msg));
+      oitEngine = OIT_LISTS;
+      oitTargets(width,height);
+      oitPool(width,height);
+   }
 
-         for (set = 0; set < tot_vaos; ++set)
-         {
-            glGenVertexArrays(1,&newVao);
-            glBindVertexArray(newVao);
-            err_chk = glGetError();
-            if (err_chk != 0)
-               cout << "error update cells 1 is: " << err_chk << endl;
-
-            glBindBuffer(GL_ARRAY_BUFFER,sphere_pt_vbo); // sphere vertex coords
-            glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 0, nullptr);
-            glEnableVertexAttribArray(0);
-            glBindBuffer(GL_ARRAY_BUFFER,sphere_norm_vbo); // sphere normals
-            glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, 0, nullptr);
-            glEnableVertexAttribArray(1);
-
-             // Note: the hard-wired numbers, such as this 
-             //                        V
-             //  glVertexAttribPointer(2, 3, GL_FLOAT, GL_FALSE, 0, nullptr);
-             //  glEnableVertexAttribArray(2);
-             //  glVertexAttribDivisor(2,1); 
-             // are the ids for the vbos.
-             // They have to match the same hardwired numbers in the glsl
-             // shaders that use the vbo contents. 
-
-            if (have_ctl && c_coord_bytes)
-            {
-               glGenBuffers(1,&ctl_pt_vbo);       // cell coords
-               glBindBuffer(GL_ARRAY_BUFFER,ctl_pt_vbo);
-               glBufferData(GL_ARRAY_BUFFER,c_coord_bytes,cthCoords[CONTROL_PTS].data(),GL_STATIC_DRAW);
-               glVertexAttribPointer(2, 3, GL_FLOAT, GL_FALSE, 0, nullptr);
-               glEnableVertexAttribArray(2);
-               glVertexAttribDivisor(2,1); // 1 position per sphere instance
-
-               glGenBuffers(1,&ctl_color_vbo);       // cell color indexes
-               glBindBuffer(GL_ARRAY_BUFFER,ctl_color_vbo);
-               glBufferData(GL_ARRAY_BUFFER,c_color_bytes,cthColorIdx[CONTROL_COLORS][set].data(),GL_STATIC_DRAW);
-               glVertexAttribIPointer(5, 1, GL_INT, 0, nullptr);
-               glEnableVertexAttribArray(5);
-               glVertexAttribDivisor(5,1); // 1 color index per sphere instance
-            }
+   err_chk = glGetError();
+   if (err_chk != 0)
+      cout << "oit targets error is: " << err_chk << endl;
+}
 
-            if (have_stim && s_coord_bytes)
-            {
-               glGenBuffers(1,&stim_pt_vbo);      // stim cell coords
-               glBindBuffer(GL_ARRAY_BUFFER,stim_pt_vbo);
-               glBufferData(GL_ARRAY_BUFFER,s_coord_bytes,cthCoords[STIM_PTS].data(),GL_STATIC_DRAW);
-               glVertexAttribPointer(3, 3, GL_FLOAT, GL_FALSE, 0, nullptr);
-               glEnableVertexAttribArray(3);
-               glVertexAttribDivisor(3,1); // 1 position per sphere instance
-
-               glGenBuffers(1,&stim_color_vbo);       // stim color indexes
-               glBindBuffer(GL_ARRAY_BUFFER,stim_color_vbo);
-               glBufferData(GL_ARRAY_BUFFER,s_color_bytes,cthColorIdx[STIM_COLORS][set].data(),GL_STATIC_DRAW);
-               glVertexAttribIPointer(6, 1, GL_INT, 0, nullptr);
-               glEnableVertexAttribArray(6);
-               glVertexAttribDivisor(6,1); // 1 color index per sphere instance
-            }
+// The weighted and peeling engines test against the opaque pass's depth
+// in their own framebuffer. Leaves that framebuffer bound.
+bool BrainStemGL::copyDepth()
+{
+   glGetError();
+   glBindFramebuffer(GL_READ_FRAMEBUFFER,defaultFramebufferObject());
+   glBindFramebuffer(GL_DRAW_FRAMEBUFFER,oitFbo);
+   glBlitFramebuffer(0,0,oitTexW,oitTexH,0,0,oitTexW,oitTexH,GL_DEPTH_BUFFER_BIT,GL_NEAREST);
+   glBindFramebuffer(GL_FRAMEBUFFER,oitFbo);
+   if (glGetError() == GL_NO_ERROR)
+      return true;
+   glBindFramebuffer(GL_FRAMEBUFFER,defaultFramebufferObject());
+   return false;
+}
 
-            if (have_ctrlsibs && csib_coord_bytes)
-            {
-                // ctrl->stim sib
-               glGenBuffers(1,&csib_pt_vbo);       // cell coords
-               glBindBuffer(GL_ARRAY_BUFFER,csib_pt_vbo);
-               glBufferData(GL_ARRAY_BUFFER,csib_coord_bytes,cthCoords[CTRLSIB_PTS].data(),GL_STATIC_DRAW);
-               glVertexAttribPointer(10, 3, GL_FLOAT, GL_FALSE, 0, nullptr);
-               glEnableVertexAttribArray(10);
-               glVertexAttribDivisor(10,1); // 1 position per sphere instance
-
-               glGenBuffers(1,&csib_color_vbo);       // cell color indexes
-               glBindBuffer(GL_ARRAY_BUFFER,csib_color_vbo);
-               glBufferData(GL_ARRAY_BUFFER,csib_color_bytes,cthColorIdx[CTRLSIB_COLORS][set].data(),GL_STATIC_DRAW);
-               glVertexAttribIPointer(8, 1, GL_INT, 0, nullptr);
-               glEnableVertexAttribArray(8);
-               glVertexAttribDivisor(8,1); // 1 color index per sphere instance
-            }
+// Pick the transparency engine, an OIT_ENGINE. Only the one in use has
+// memory allocated.
+void BrainStemGL::setOitEngine(int engine)
+{
+   if (engine < OIT_LISTS || engine >= OIT_ENGINES)
+      engine = OIT_LISTS;
+   if (engine == oitEngine)
+      return;
+   oitEngine = engine;
+   makeCurrent();
+   oitTargets(geometry().width(),geometry().height());
+   oitPool(geometry().width(),geometry().height());
+   doneCurrent();
+   sceneUpdate();
+}
 
-            if (have_stimsibs && ssib_coord_bytes)
-            {
-                // stim->ctrl sib
-               glGenBuffers(1,&ssib_pt_vbo);
-               glBindBuffer(GL_ARRAY_BUFFER,ssib_pt_vbo);
-               glBufferData(GL_ARRAY_BUFFER,ssib_coord_bytes,cthCoords[STIMSIB_PTS].data(),GL_STATIC_DRAW);
-               glVertexAttribPointer(11, 3, GL_FLOAT, GL_FALSE, 0, nullptr);
-               glEnableVertexAttribArray(11);
-               glVertexAttribDivisor(11,1);
-
-               glGenBuffers(1,&ssib_color_vbo);
-               glBindBuffer(GL_ARRAY_BUFFER,ssib_color_vbo);
-               glBufferData(GL_ARRAY_BUFFER,ssib_color_bytes,cthColorIdx[STIMSIB_COLORS][set].data(),GL_STATIC_DRAW);
-               glVertexAttribIPointer(9, 1, GL_INT, 0, nullptr);
-               glEnableVertexAttribArray(9);
-               glVertexAttribDivisor(9,1);
-            }
+// Draw cells as ray cast impostors, or as sphere meshes
+void BrainStemGL::setImpostors(bool on)
+{
+   impostorCells = on;
+   cellsUpdate();
+}
 
-            err_chk = glGetError();
-            if (err_chk != 0)
-               cout << "error update cells 2 is: " << err_chk << endl;
-
-            glCTH point = { newVao,{cthCoords[CONTROL_PTS].size(),
-                                    cthCoords[STIM_PTS].size(),
-                                    cthCoords[CTRLSIB_PTS].size(),
-                                    cthCoords[STIMSIB_PTS].size(),
-                                    0}};  // painting list, no delta so far
-            cellsVao[curr_clust].push_back(point);
-            err_chk = glGetError();
-            if (err_chk != 0)
-               cout << "error update cells 3 is: " << err_chk << endl;
-         }
-      }
+// How many of the nearest fragments the k-buffer keeps exactly
+void BrainStemGL::setKBuffer(int k)
+{
+   kBufferSize = max(KBUFFER_MIN,min(k,KBUFFER_MAX));
+   if (!kBufferProgs[MONO_VIEW])   // oitTargets() builds it when it's first picked
+      return;
+   makeCurrent();
+   kBufferProgram();
+   doneCurrent();
+   sceneUpdate();
+}
+
+// (Re)build the k-buffer resolve, K is a compile time array size
+void BrainStemGL::kBufferProgram()
+{
+   string defs = "#version 430\n#define K " + to_string(kBufferSize) + "\n";
+
+   for (GLuint prog : kBufferProgs)
+      glDeleteProgram(prog);
+   viewPrograms(kBufferProgs,VIEWS,{finalRenderVSrc},{finalRenderGSrc},
+                {GL_FRAGMENT_SHADER,defs,{kBufferFSrc}},"kBufferProg");
+   finishPrograms();
+}
+
+// What goes in front of a shader's sources for one view. Whether it draws
+// one eye or both, and which one, are #defines, so a geometry shader's
+// invocation count matches and there is nothing to test per primitive.
+// Vertex shaders for a view pick the viewport themselves, those for
+// NO_VIEW feed a geometry shader that does.
+string BrainStemGL::viewHead(GLenum type, int view)
+{
+   const char* eyes[CELL_VIEWS] = {
+      "#define EYES 1\n#define EYE 0\n",
+      type == GL_VERTEX_SHADER ? "#define EYES 2\n#define EYE (gl_InstanceID & 1)\n"
+                               : "#define EYES 2\n#define EYE gl_InvocationID\n",
+      "#define EYES 1\n#define EYE 1\n"};
+   string head = "#version 430\n";
+
+   if (view != NO_VIEW)
+   {
+      if (type == GL_VERTEX_SHADER)
+         head = head + vsViewportExt + "#define VS_VIEWS\n";
+      head += eyes[view];
+   }
+   return head;
+}
+
+// Start a program for each of the first views. The vertex shader picks the
+// viewport if the driver lets it, else the geometry shader does.
+void BrainStemGL::viewPrograms(GLuint *progs, int views, const vector<const char*>& vs,
+                               const vector<const char*>& gs, const shaderSrcs& fs, const char* name)
+{
+   for (int view = 0; view < views; ++view)
+   {
+      if (vsViewports)
+         buildProgram(&progs[view],{{GL_VERTEX_SHADER,viewHead(GL_VERTEX_SHADER,view),vs},fs},name);
+      else
+         buildProgram(&progs[view],{{GL_VERTEX_SHADER,viewHead(GL_VERTEX_SHADER,NO_VIEW),vs},
+                                    {GL_GEOMETRY_SHADER,viewHead(GL_GEOMETRY_SHADER,view),gs},fs},name);
+   }
+}
+
+// Start linking a program from its stages into prog. Linked programs are
+// saved in shaderCache, so later runs load them rather than compile, unless
+// a source or the driver changed. Nothing here waits on the driver, so with
+// parallel shader compiles it builds them all at once. finishPrograms()
+// waits for them, prog is 0 if it didn't link.
+void BrainStemGL::buildProgram(GLuint *prog, const vector<shaderSrcs>& stages, const char* name)
+{
+   QString file = programFile(stages);
+
+   *prog = loadProgram(file);
+   if (*prog)
+      return;
+   *prog = glCreateProgram();
+   for (const shaderSrcs& stage : stages)
+   {
+      vector<const char*> srcs = stage.srcs;
+      GLuint shader = glCreateShader(stage.type);
+
+      if (!stage.head.empty())
+         srcs.insert(srcs.begin(),stage.head.c_str());
+      glShaderSource(shader,srcs.size(),srcs.data(),nullptr);
+      glCompileShader(shader);
+      glAttachShader(*prog,shader);
+      glDeleteShader(shader);    // goes with the program
+   }
+   if (!file.isEmpty())
+      glProgramParameteri(*prog,GL_PROGRAM_BINARY_RETRIEVABLE_HINT,GL_TRUE);
+   glLinkProgram(*prog);
+   pendingProgs.push_back({prog,file,name});
+}
+
+// Wait for the programs buildProgram() started. Those that didn't link
+// report why and are deleted, the rest are saved for the next run.
+void BrainStemGL::finishPrograms()
+{
+   GLint linked;
+   GLuint shaders[3];
+   GLsizei count;
+
+   for (pendingProgram& pending : pendingProgs)
+   {
+      glGetProgramiv(*pending.prog,GL_LINK_STATUS,&linked);
+      if (linked == GL_TRUE)
+      {
+         ++builtPrograms;
+         saveProgram(*pending.prog,pending.file);
+         continue;
+      }
+      glGetAttachedShaders(*pending.prog,3,&count,shaders);
+      for (GLsizei shader = 0; shader < count; ++shader)
+         chkcomp(shaders[shader],pending.name);
+      chklink(*pending.prog,pending.name);
+      glDeleteProgram(*pending.prog);
+      *pending.prog = 0;
+   }
+   pendingProgs.clear();
+}
+
+// A program's cache file, named by a hash of the driver and everything
+// compiled into it. Empty if there is no cache.
+QString BrainStemGL::programFile(const vector<shaderSrcs>& stages)
+{
+   QCryptographicHash hash(QCryptographicHash::Sha1);
+
+   if (shaderCache.isEmpty())
+      return QString();
+   hash.addData(shaderCacheId);
+   for (const shaderSrcs& stage : stages)
+   {
+      hash.addData(reinterpret_cast<const char*>(&stage.type),sizeof(stage.type));
+      hash.addData(stage.head.c_str(),stage.head.size()+1);   // the nuls keep sources apart
+      for (const char* src : stage.srcs)
+         hash.addData(src,strlen(src)+1);
+   }
+   return shaderCache + "/" + hash.result().toHex() + ".bin";
+}
+
+// Load a cached program, 0 if there is none or the driver turns it down,
+// as it can after an update that kept the version string.
+GLuint BrainStemGL::loadProgram(const QString& file)
+{
+   QFile in(file);
+   QByteArray bin;
+   GLenum format;
+   GLint linked = GL_FALSE;
+   GLuint prog;
+
+   if (file.isEmpty() || !in.open(QIODevice::ReadOnly))
+      return 0;
+   bin = in.readAll();
+   if (bin.size() <= int(sizeof(format)))
+      return 0;
+   memcpy(&format,bin.constData(),sizeof(format));
+   prog = glCreateProgram();
+   glProgramBinary(prog,format,bin.constData()+sizeof(format),bin.size()-sizeof(format));
+   glGetProgramiv(prog,GL_LINK_STATUS,&linked);
+   if (linked != GL_TRUE)
+   {
+      glDeleteProgram(prog);
+      while (glGetError() != GL_NO_ERROR)   // a format it no longer knows
+         ;
+      return 0;
+   }
+   ++cachedPrograms;
+   return prog;
+}
+
+// Save a linked program for the next run, the binary's format then the
+// binary. QSaveFile only replaces the old file once it's all written.
+void BrainStemGL::saveProgram(GLuint prog, const QString& file)
+{
+   GLint len = 0;
+   GLenum format;
+   QByteArray bin;
+
+   if (file.isEmpty())
+      return;
+   glGetProgramiv(prog,GL_PROGRAM_BINARY_LENGTH,&len);
+   if (len <= 0)
+      return;
+   bin.resize(len);
+   glGetProgramBinary(prog,len,&len,&format,bin.data());
+   QSaveFile out(file);
+   if (!out.open(QIODevice::WriteOnly))
+      return;
+   out.write(reinterpret_cast<const char*>(&format),sizeof(format));
+   out.write(bin.constData(),len);
+   out.commit();
+}
+
+// Every view of the mesh and impostor cell programs that built, their
+// uniforms have to be set in all of them.
+vector<GLuint> BrainStemGL::cellPrograms()
+{
+   vector<GLuint> progs;
+   for (int view = 0; view < CELL_VIEWS; ++view)
+      for (GLuint prog : {cellProgs[view], cellImpProgs[view]})
+         if (prog)
+            progs.push_back(prog);
+   return progs;
+}
+
+// The lighting, materials, and point size for the frame in this ring slot.
+// The sliders just change the values it's made from and mark every slot
+// stale, so dragging one costs a copy per frame, not uniform calls in every
+// program for each step. The lights are gray.
+void BrainStemGL::frameLights(GLintptr slot)
+{
+   lightBlock lights;
+
+   if (lightStale > 0)
+   {
+      lights.ambient = glm::vec3(ambient/100.0);
+      lights.skinTrans = skinTrans;
+      lights.lightColor = glm::vec3(diffuse/100.0);
+      lights.cellTrans = cellTrans;
+      lights.lightDir = glm::vec3(dX,dY,dZ);
+      lights.regionTrans = regionTrans;
+      lights.scale = ptSize;
+      lights.hideOff = hideCells;
+      lights.surfaceSel = surfaceSel;
+      lights.pad = 0;
+      if (frameRingPtr)
+         memcpy(frameRingPtr + slot + lightOffset,&lights,sizeof(lights));
+      else
+      {
+         glBindBuffer(GL_UNIFORM_BUFFER,frameRingBuff);
+         glBufferSubData(GL_UNIFORM_BUFFER,slot + lightOffset,sizeof(lights),&lights);
+      }
+      --lightStale;
+   }
+   glBindBufferRange(GL_UNIFORM_BUFFER,lightUboBlkId,frameRingBuff,slot + lightOffset,sizeof(lights));
+}
+
+// Start building the compute resolve. The sizes above go in front of the
+// shaders, so they and the C++ agree, ahead of the cell shading the resolve
+// shares with the cell shader. It's used if they all link, see initializeGL().
+void BrainStemGL::tilePrograms()
+{
+   const int fragments[TILE_CLASSES] = {0, TILE_SHORT_MAX, TILE_MEDIUM_MAX, TILE_LONG_MAX};
+   const char* names[TILE_CLASSES] = {"", "tileShortProg", "tileMediumProg", "tileLongProg"};
+   string defs = "#version 430\n#define TILE " + to_string(OIT_TILE)
+               + "\n#define TILE_BINS " + to_string(TILE_BINS)
+               + "\n#define TILE_CLASSES " + to_string(TILE_CLASSES)
+               + "\n#define SHORT_MAX " + to_string(TILE_SHORT_MAX)
+               + "\n#define MEDIUM_MAX " + to_string(TILE_MEDIUM_MAX)
+               + "\n#define LONG_MAX " + to_string(TILE_LONG_MAX) + "\n";
+   string kernel;
+
+   buildProgram(&tileClassProg,{{GL_COMPUTE_SHADER,defs,{cellShadeSrc,tileDeclSrc,tileClassCSrc}}},"tileClassProg");
+   for (int cls = TILE_SHORT; cls < TILE_CLASSES; ++cls)
+   {
+      kernel = defs + "#define TILE_CLASS " + to_string(cls)
+                    + "\n#define MAX_FRAGMENTS " + to_string(fragments[cls]) + "\n";
+      buildProgram(&tileSortProg[cls],{{GL_COMPUTE_SHADER,kernel,
+                                        {cellShadeSrc,tileDeclSrc,cls == TILE_LONG ? tileMergeCSrc : tileSortCSrc}}},names[cls]);
+   }
+}
+
+// average fragments per pixel the OIT pool is sized for
+void BrainStemGL::setOitDepth(double depth)
+{
+   oitDepth = max(depth,1.0);
+   makeCurrent();
+   oitPool(geometry().width(),geometry().height());
+   doneCurrent();
+}
+
+// The transforms and the OIT atomic counter change every frame. Rather than
+// map/unmap a buffer per frame (a sync point on many drivers), keep
+// FRAME_SLOTS copies in one buffer and write into a slot the gpu has finished
+// with. With ARB_buffer_storage the buffer is mapped once, persistent and
+// coherent, so a frame update is just a memcpy.
+void BrainStemGL::frameRing()
+{
+   GLint align;
+   GLenum err_chk = glGetError();
+   PFNGLBUFFERSTORAGEPROC bufferStorage = nullptr;
+   GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+
+   glGetIntegerv(GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT,&align);
+   auto alignUp = [align] (GLintptr val) { return (val + align - 1) / align * align; };
+
+   mvpSize = sizeof(mvpMat);
+   mvSize = sizeof(mvMat);
+   mvpOffset = 0;
+   mvOffset = alignUp(mvpOffset + mvpSize);
+   lightOffset = alignUp(mvOffset + mvSize);
+   counterOffset = alignUp(lightOffset + sizeof(lightBlock));
+   frameSlotSize = alignUp(counterOffset + sizeof(GLuint));
+   GLsizeiptr ring_bytes = frameSlotSize * FRAME_SLOTS;
+
+   if (context()->hasExtension(QByteArrayLiteral("GL_ARB_buffer_storage")))
+      bufferStorage = reinterpret_cast<PFNGLBUFFERSTORAGEPROC>(context()->getProcAddress("glBufferStorage"));
+
+   glGenBuffers(1,&frameRingBuff);
+   glBindBuffer(GL_UNIFORM_BUFFER,frameRingBuff);
+   if (bufferStorage)
+   {
+      bufferStorage(GL_UNIFORM_BUFFER,ring_bytes,nullptr,flags);
+      frameRingPtr = (unsigned char*) glMapBufferRange(GL_UNIFORM_BUFFER,0,ring_bytes,flags);
+      if (frameRingPtr == nullptr) // storage is immutable, start over
+      {
+         glDeleteBuffers(1,&frameRingBuff);
+         glGenBuffers(1,&frameRingBuff);
+         glBindBuffer(GL_UNIFORM_BUFFER,frameRingBuff);
+      }
+   }
+   if (frameRingPtr == nullptr)  // fall back to buffer sub data updates
+      glBufferData(GL_UNIFORM_BUFFER,ring_bytes,nullptr,GL_DYNAMIC_DRAW);
+
+     // the node counts are read back the same way, or with get sub data
+   GLsizeiptr count_bytes = FRAME_SLOTS * sizeof(GLuint);
+   GLbitfield read_flags = GL_MAP_READ_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+   glGenBuffers(1,&counterReadBuff);
+   glBindBuffer(GL_COPY_WRITE_BUFFER,counterReadBuff);
+   if (bufferStorage)
+   {
+      bufferStorage(GL_COPY_WRITE_BUFFER,count_bytes,nullptr,read_flags);
+      counterReadPtr = (GLuint*) glMapBufferRange(GL_COPY_WRITE_BUFFER,0,count_bytes,read_flags);
+      if (counterReadPtr == nullptr)
+      {
+         glDeleteBuffers(1,&counterReadBuff);
+         glGenBuffers(1,&counterReadBuff);
+         glBindBuffer(GL_COPY_WRITE_BUFFER,counterReadBuff);
+      }
+   }
+   if (counterReadPtr == nullptr)
+      glBufferData(GL_COPY_WRITE_BUFFER,count_bytes,nullptr,GL_STREAM_READ);
+   glBindBuffer(GL_COPY_WRITE_BUFFER,0);
+
+   if (Debug)
+   {
+      QString msg;
+      QTextStream(&msg) << "Frame uniforms: " << FRAME_SLOTS << " slots of " << frameSlotSize << " bytes, "
+                        << (frameRingPtr ? "persistent mapped" : "buffer sub data") << endl;
+      emit(chatBox(msg));
+   }
+
+   err_chk = glGetError();
+   if (err_chk != 0)
+      cout << "frame ring error is: " << err_chk << endl;
+}
+
+// Move to the next ring slot, waiting for the gpu if it is still using it.
+// With three slots this almost never waits.
+void BrainStemGL::nextFrameSlot()
+{
+   frameSlot = (frameSlot + 1) % FRAME_SLOTS;
+   if (frameFence[frameSlot])
+   {
+      GLenum res = glClientWaitSync(frameFence[frameSlot],GL_SYNC_FLUSH_COMMANDS_BIT,FENCE_WAIT);
+      if (res == GL_TIMEOUT_EXPIRED || res == GL_WAIT_FAILED)
+         cout << "frame ring wait failed: " << res << endl;
+      glDeleteSync(frameFence[frameSlot]);
+      frameFence[frameSlot] = nullptr;
+   }
+   if (counterCopied[frameSlot])   // grown before this frame, if it needs to be
+      oitCount(frameSlot);
+}
+
+// The node count from the frame that used this ring slot is back. Keep
+// the peak, and if the pool was too small for that frame grow it. True if
+// the pool grew, so the frame should be drawn again.
+bool BrainStemGL::oitCount(int slot)
+{
+   GLuint count;
+   GLuint nodes = oitNodes;
+
+   counterCopied[slot] = false;
+   if (counterReadPtr)
+      count = counterReadPtr[slot];
+   else
+   {
+      glBindBuffer(GL_COPY_WRITE_BUFFER,counterReadBuff);
+      glGetBufferSubData(GL_COPY_WRITE_BUFFER,slot*sizeof(GLuint),sizeof(GLuint),&count);
+      glBindBuffer(GL_COPY_WRITE_BUFFER,0);
+   }
+   oitPeak = max(oitPeak,count);
+   if (count <= oitNodes)
+      return false;
+
+   oitGrown = GLint64(count * OIT_GROW);
+   oitPool(geometry().width(),geometry().height());
+   QString msg;
+   QTextStream(&msg) << "Transparency needed " << count << " fragments, had room for " << nodes
+                     << (oitNodes > nodes ? ", made more room." : ", can't make more.");
+   emit(chatBox(msg));
+   return oitNodes > nodes;
+}
+
+// Read the node counts of frames the gpu has finished, without waiting for
+// the rest. A still picture is not drawn again on its own, so if the last
+// frame overflowed, draw it again with the bigger pool. The frame that
+// overflowed has already been shown missing fragments by then, waiting for
+// its count before the swap would stall every frame. Only snapshots and
+// movie frames wait, see grabComplete().
+void BrainStemGL::pollOitCount()
+{
+   bool pending = false, grew = false;
+   GLint status;
+
+   oitPolling = false;
+   makeCurrent();
+   for (int slot = 0; slot < FRAME_SLOTS; ++slot)
+   {
+      if (!counterCopied[slot] || !frameFence[slot])
+         continue;
+      glGetSynciv(frameFence[slot],GL_SYNC_STATUS,1,nullptr,&status);
+      if (status == GL_SIGNALED)
+         grew = oitCount(slot) || grew;
+      else
+         pending = true;
+   }
+   doneCurrent();
+   if (grew)
+      sceneUpdate();
+   else if (pending)
+   {
+      oitPolling = true;
+      QTimer::singleShot(OIT_POLL_MS,this,&BrainStemGL::pollOitCount);
+   }
+}
+
+// Snapshots and movie frames have to be complete. Wait for the frame's node
+// count, and if the pool was too small draw it again with a bigger one.
+QImage BrainStemGL::grabComplete()
+{
+   QImage frame = grabFramebuffer();
+
+   GLenum res;
+
+   makeCurrent();
+   while (counterCopied[frameSlot] && frameFence[frameSlot])   // drawn with lists
+   {
+      do
+         res = glClientWaitSync(frameFence[frameSlot],GL_SYNC_FLUSH_COMMANDS_BIT,FENCE_WAIT);
+      while (res == GL_TIMEOUT_EXPIRED);
+      if (res == GL_WAIT_FAILED)
+      {
+         emit(chatBox("Could not wait for the frame's transparency count, it may be missing fragments."));
+         break;
+      }
+      if (!oitCount(frameSlot))
+         break;
+      frame = grabFramebuffer();
+      makeCurrent();
+   }
+   return frame;
+}
+
+// Big files have a lot of cells. Upload their buffers from another thread
+// with a context that shares with ours so drawing doesn't stall. If we can't
+// get one, the uploads happen here.
+void BrainStemGL::cellLoader()
+{
+   QString msg;
+
+   qRegisterMetaType<cellUploadPtr>("cellUploadPtr");
+   uploader = new cellUploader;
+   if (uploader->share(context()))
+   {
+      uploadThread = new QThread(this);
+      uploader->moveToThread(uploadThread);
+      connect(this,&BrainStemGL::uploadCells,uploader,&cellUploader::upload);
+      connect(uploader,&cellUploader::uploaded,this,&BrainStemGL::swapCells);
+      uploadThread->start();
+   }
+   else
+      uploader->useCurrent();
+
+   if (Debug)
+   {
+      QTextStream(&msg) << "Cell uploads: " << (uploadThread ? "upload thread" : "GUI thread");
+      emit(chatBox(msg));
+   }
+}
+
+cellUploader::cellUploader(QObject *parent) : QObject(parent)
+{
+}
+
+cellUploader::~cellUploader()
+{
+   delete uploadContext;
+   delete surface;
+}
+
+// Make a context that shares with the widget's. It is our child so it
+// moves to the upload thread with us. The surface has to stay in the GUI
+// thread.
+bool cellUploader::share(QOpenGLContext* widget_context)
+{
+   uploadContext = new QOpenGLContext(this);
+   uploadContext->setFormat(widget_context->format());
+   uploadContext->setShareContext(widget_context);
+   if (uploadContext->create() && QOpenGLContext::areSharing(uploadContext,widget_context))
+   {
+      surface = new QOffscreenSurface;
+      surface->setFormat(uploadContext->format());
+      surface->create();
+      if (surface->isValid())
+         return true;
+      delete surface;
+      surface = nullptr;
+   }
+   delete uploadContext;
+   uploadContext = nullptr;
+   return false;
+}
+
+// no thread, upload with the caller's current context
+bool cellUploader::useCurrent()
+{
+   haveFuncs = initializeOpenGLFunctions();
+   return haveFuncs;
+}
+
+// runs in the upload thread, a job that couldn't be sent comes back without
+// buffers
+void cellUploader::upload(cellUploadPtr job)
+{
+   if (!uploadContext->makeCurrent(surface))
+   {
+      emit(uploaded(job));
+      return;
+   }
+   if (!haveFuncs)
+      haveFuncs = initializeOpenGLFunctions();
+   send(*job);
+   uploadContext->doneCurrent();
+   emit(uploaded(job));
+}
+
+// Create the buffers for a cell update in the current context and fence them
+// so whoever draws with them can wait for the gpu to have them.
+void cellUploader::send(cellUpload& job)
+{
+   vector<GLint> rows(max(job.cells.size(),size_t(1)));
+
+   iota(rows.begin(),rows.end(),0);
+   glGenBuffers(1,&job.cellTabVbo);
+   glBindBuffer(GL_SHADER_STORAGE_BUFFER,job.cellTabVbo);
+   glBufferData(GL_SHADER_STORAGE_BUFFER,job.cells.size()*sizeof(cellRow),job.cells.data(),GL_STATIC_DRAW);
+   glGenBuffers(1,&job.cthTabVbo);
+   glBindBuffer(GL_SHADER_STORAGE_BUFFER,job.cthTabVbo);
+   glBufferData(GL_SHADER_STORAGE_BUFFER,job.cths.size()*sizeof(GLfloat),job.cths.data(),GL_STATIC_DRAW);
+   glBindBuffer(GL_SHADER_STORAGE_BUFFER,0);
+   glGenBuffers(1,&job.rowVbo);
+   glBindBuffer(GL_ARRAY_BUFFER,job.rowVbo);
+   glBufferData(GL_ARRAY_BUFFER,rows.size()*sizeof(GLint),rows.data(),GL_STATIC_DRAW);
+   glBindBuffer(GL_ARRAY_BUFFER,0);
+   job.fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE,0);
+   glFlush();     // the fence has to get to the gpu before anyone waits on it
+   cellTable().swap(job.cells);         // done with these
+   vector<GLfloat>().swap(job.cths);
+}
+
+// draw one period list of a cluster, its rows in the cell table
+void BrainStemGL::drawCells(glCTH& cells, int list)
+{
+   if (!cells.cellSize[list])
+      return;
+   if (lodDrawVbo)   // a draw per level, filled in by cullCells()
+      glMultiDrawArraysIndirect(useImpostors ? GL_POINTS : GL_TRIANGLES,
+                                (void*)(cells.lod[list]*sizeof(lodCommand)),SPHERE_LODS,0);
+   else if (useImpostors)   // a point each, made a square
+      glDrawArraysInstancedBaseInstance(GL_POINTS,0,1,cells.cellSize[list],cells.first[list]);
+   else
+      glDrawArraysInstancedBaseInstance(GL_TRIANGLES,sphereFirst[SPHERE_LODS-1],sphereCount[SPHERE_LODS-1],
+                                        cells.cellSize[list] * cellCopies(),cells.first[list]);
+}
+
+// Instances per cell. Meshes whose vertex shader picks the viewport draw
+// one per eye in the stereo view, the rows' divisor has to match.
+// Impostors always have a geometry shader, the pairs draw an eye at a time.
+GLuint BrainStemGL::cellCopies()
+{
+   bool pair = stereoMode == CTRL_STIM_PAIR || stereoMode == CTRLSIB_PAIR || stereoMode == STIMSIB_PAIR;
+   return vsViewports && !useImpostors && stereoView == STEREO_VIEW && !pair ? 2 : 1;
+}
+
+// Is this period list drawn in the current stereo mode
+bool BrainStemGL::cellListShown(int list)
+{
+   switch (stereoMode)
+   {
+      case CTRL_STIM_PAIR:
+         return list == CONTROL_PTS || list == STIM_PTS;
+
+      case CTRLSIB_PAIR:
+         return list == CONTROL_PTS || list == CTRLSIB_PTS;
+
+      case STIMSIB_PAIR:
+         return list == STIMSIB_PTS || list == STIM_PTS;
+
+      case CONTROL_ONLY:
+      case CONTROL_STEREO:
+         return list == CONTROL_PTS;
+
+      case STIM_ONLY:
+      case STIM_STEREO:
+         return list == STIM_PTS;
+
+      case DELTA_ONLY:
+      case DELTA_STEREO:
+         return list == DELTA_PTS;
+
+      case CTRLSIB_ONLY:
+      case CTRLSIB_STEREO:
+         return list == CTRLSIB_PTS;
+
+      case STIMSIB_ONLY:
+      case STIMSIB_STEREO:
+         return list == STIMSIB_PTS;
+
+      default:
+         return false;
+   }
+}
+
+// Make the cells' draws, one per level of detail for each list that has
+// cells. The clusters' lists are in the cell table in the order we go
+// through them, which the cull pass counts on. Each level of a list gets
+// room in its row buffer for all of the list's cells. The draws' shapes
+// are filled in by cullCells().
+void BrainStemGL::lodLists()
+{
+   GLuint cells = 0;
+
+   lodInit.clear();
+   for (auto& range : cellRows)
+      for (int list = 0; list < NUM_PT_LISTS; ++list)
+         cells = max(cells,GLuint(range.second.first[list] + range.second.cellSize[list]));
+   for (auto& range : cellRows)
+      for (int list = 0; list < NUM_PT_LISTS; ++list)
+      {
+         range.second.lod[list] = lodInit.size();
+         if (range.second.cellSize[list])
+            for (int lod = 0; lod < SPHERE_LODS; ++lod)
+               lodInit.push_back({0, 0, 0, lod * cells + range.second.first[list]});
+      }
+   lodListCount = lodInit.size() / SPHERE_LODS;
+   lodCellCount = cells;
+   if (!cellCullProg || !lodListCount)
+      return;
+
+   glGenBuffers(1,&lodInitVbo);
+   glBindBuffer(GL_COPY_WRITE_BUFFER,lodInitVbo);
+   glBufferData(GL_COPY_WRITE_BUFFER,lodInit.size()*sizeof(lodCommand),lodInit.data(),GL_DYNAMIC_COPY);
+   glGenBuffers(1,&lodDrawVbo);
+   glBindBuffer(GL_COPY_WRITE_BUFFER,lodDrawVbo);
+   glBufferData(GL_COPY_WRITE_BUFFER,lodInit.size()*sizeof(lodCommand),nullptr,GL_DYNAMIC_COPY);
+   glGenBuffers(1,&lodRowVbo);
+   glBindBuffer(GL_COPY_WRITE_BUFFER,lodRowVbo);
+   glBufferData(GL_COPY_WRITE_BUFFER,SPHERE_LODS*cells*sizeof(GLint),nullptr,GL_DYNAMIC_COPY);
+   glBindBuffer(GL_COPY_WRITE_BUFFER,0);
+   glBindBufferBase(GL_SHADER_STORAGE_BUFFER,1,lodRowVbo);
+   glBindBufferBase(GL_SHADER_STORAGE_BUFFER,7,lodDrawVbo);
+}
+
+// The cull pass, for this frame's view. The draws start out empty, each
+// cell that can be seen goes in its list's draw for the level it needs.
+// Lists that aren't drawn, their cluster is off or the stereo mode doesn't
+// show them, get no triangles, and the pass skips their cells. Impostors
+// are a point in the first level.
+void BrainStemGL::cullCells()
+{
+   GLenum err_chk;
+   bool changed = false;
+   size_t draw = 0;
+   int idx, list, lod;
+   cellRowListIter iter;
+
+   for (idx = 0, iter = cellRows.begin(); iter != cellRows.end(); ++idx,++iter)
+      for (list = 0; list < NUM_PT_LISTS; ++list)
+         if (iter->second.cellSize[list])
+         {
+            bool shown = onOff[idx] && cellListShown(list);
+            for (lod = 0; lod < SPHERE_LODS; ++lod,++draw)
+            {
+               GLuint count = !shown ? 0 : useImpostors ? (lod == 0) : sphereCount[lod];
+               GLuint first = useImpostors ? 0 : sphereFirst[lod];
+               changed = changed || lodInit[draw].count != count || lodInit[draw].first != first;
+               lodInit[draw].count = count;
+               lodInit[draw].first = first;
+            }
+         }
+   if (changed)
+   {
+      glBindBuffer(GL_COPY_WRITE_BUFFER,lodInitVbo);
+      glBufferSubData(GL_COPY_WRITE_BUFFER,0,lodInit.size()*sizeof(lodCommand),lodInit.data());
+   }
+   glBindBuffer(GL_COPY_READ_BUFFER,lodInitVbo);
+   glBindBuffer(GL_COPY_WRITE_BUFFER,lodDrawVbo);
+   glCopyBufferSubData(GL_COPY_READ_BUFFER,GL_COPY_WRITE_BUFFER,0,0,lodInit.size()*sizeof(lodCommand));
+   glBindBuffer(GL_COPY_READ_BUFFER,0);
+   glBindBuffer(GL_COPY_WRITE_BUFFER,0);
+
+   glUseProgram(cellCullProg);
+   glUniform1ui(0,lodCellCount);
+   glUniform1i(1,lodListCount);
+   glUniform1f(2,SPHERE_RADIUS / max(ptSize,1));
+   glUniform1f(3,projMat[1][1] * viewPortH / 2.0);
+   glUniform1i(4,projMat[2][3] != 0.0);
+   glUniform1i(5,hideCells);
+   glUniform1f(6,currCycle ? cyclePhase : -1.0);
+   glUniform1i(7,numBins);
+   glUniform1i(8,stereoViewports);
+   glUniform1i(9,useImpostors ? 1 : SPHERE_LODS);
+   glUniform1ui(10,cellCopies());
+   glDispatchCompute((lodCellCount + LOD_GROUP - 1) / LOD_GROUP,1,1);
+   glMemoryBarrier(GL_COMMAND_BARRIER_BIT | GL_VERTEX_ATTRIB_ARRAY_BARRIER_BIT);
+   err_chk = glGetError();
+   if (err_chk != 0)
+      cout << "cull cells error is: " << err_chk << endl;
+}
+
+// Gather the normalized CTHs for every period list and cluster into
+// contiguous blocks, one row of bins per cell, ready to go to the shader.
+// Only needed for a new file, experiment changes just filter the results.
+// The sibling lists are indexes into the other period's list.
+void BrainStemGL::gatherCells(cellArray& dispCells, sibArray& sibCells)
+{
+   const int sibOf[NUM_CELL_COLORS] = {0, 0, STIM_COLORS, CONTROL_COLORS, 0};
+
+   for (int list = CONTROL_COLORS; list < NUM_CELL_COLORS; ++list)
+   {
+      cthColors[list].clear();
+      if (list == CTRLSIB_COLORS || list == STIMSIB_COLORS)
+      {
+         Cells& others = dispCells[sibOf[list]];
+         for (SibIter siter = sibCells[list].begin(); siter != sibCells[list].end(); ++siter)
+         {
+            cthBlock& block = cthColors[list][siter->first];
+            block.delta = false;
+            for (cellIndex& idx : siter->second)
+               addCell(block,others[idx.first][idx.second]);
+         }
+         continue;
+      }
+      for (CellIter citer = dispCells[list].begin(); citer != dispCells[list].end(); ++citer)
+      {
+         cthBlock& block = cthColors[list][citer->first];
+         block.delta = (list == DELTA_COLORS);
+         for (ClusterIter cell = citer->second.begin(); cell != citer->second.end(); ++cell)
+            addCell(block,*cell);
+      }
+   }
+}
+
+// add one cell's position and CTH row to a block
+void BrainStemGL::addCell(cthBlock& block, OneRec& cell)
+{
+   size_t pt, bin;
+
+      // some cells don't have stereotaxic coords.  If at origin,
+      // it is one of those cells. Don't draw it.
+   if (cell.rl == 0.0 && cell.dp == 0.0 && cell.ap == 0.0)
+      return;
+   block.coords.push_back(glm::vec3(cell.rl, -cell.dp, -cell.ap));
+   block.expIdx.push_back(cell.expidx);
+   block.offset.push_back(block.delta ? -1 : cell.coloridx*COLOR_STEPS);
+   pt = block.normCth.size();
+   block.normCth.resize(pt+numBins,0.0);
+   for (bin = 0; bin < numBins && bin < cell.normCth.size(); ++bin)
+      block.normCth[pt+bin] = cell.normCth[bin];
+}
+
+// Add the cells in a block that are in selected experiments to the cell
+// table and their CTHs to the CTH table. Rows in both are in the same order.
+void BrainStemGL::visibleCells(cthBlock& block, vector<int>& exp_on_off, cellTable& cells, vector<GLfloat>& cths)
+{
+   size_t num = block.coords.size();
+
+   for (size_t pt = 0; pt < num; ++pt)
+   {
+      if (exp_on_off.size() && !exp_on_off[block.expIdx[pt]])
+         continue;
+      cells.push_back({block.coords[pt],block.offset[pt]});
+      cths.insert(cths.end(),block.normCth.begin()+pt*numBins,block.normCth.begin()+(pt+1)*numBins);
+   }
+}
+
+// Time to update the cells.
+// Two cases
+//   new file - clear all the old stuff out and build new gl stuff
+//   on_off  -   only show selected on_off_vals
+void BrainStemGL::updateCells(bool new_file, bool exp_chg, bool delta_cths, 
+                 vector<int>& on_off_vals, vector<int>& exp_on_off, 
+                 cellArray& dispCells, sibArray& sibCells, ClustRGB& rgbClustMap, bool have_phrenic)
+{
+   int curr_clust;
+   cellUploadPtr job;
+   CellIter citer;
+   bool have_ctl = false;
+   bool have_stim = false;
+   QString msg;
+   int num_clusts = on_off_vals.size();
+
+   haveDelta = delta_cths;
+   onOff = on_off_vals;
+   havePhrenic = have_phrenic;
+   if (haveDelta)              // add fake checkbox at end for delta CTHs
+      onOff.push_back(true);
+
+   if (new_file || exp_chg) // must (re) build cell tables
+   {
+      clearInfo();
+      makeCurrent();         // operate in current GL context
+      if (new_file)          // else old cells draw until new ones are ready
+         clearClusts();
+      createShades(rgbClustMap);
+      updateCellProg();
+
+         // If we get this far, at least one list has cells. Get # bins.
+         // We currently only support files with just control periods,
+         // or ctl/stim periods for one type of stim. We assume the loader
+         // has checked for this and will not call us if there are no 
+         // or too many periods. Delta, ctrlsib and stimsib lists are
+         // created synthetically.
+      int ctl_bins = 0;
+      int stim_bins = 0;
+      if (dispCells[CONTROL_COLORS].size())
+         have_ctl = true;
+      if (dispCells[STIM_COLORS].size())
+         have_stim = true;
+
+      if (have_ctl)
+      {
+         citer = dispCells[CONTROL_COLORS].begin();
+         if (citer != dispCells[CONTROL_COLORS].end())
+            ctl_bins = citer->second.begin()->normCth.size();
+      }
+      if (have_stim) 
+      {
+         citer = dispCells[STIM_COLORS].begin();
+         if (citer != dispCells[STIM_COLORS].end())
+            stim_bins = citer->second.begin()->normCth.size();
+      }
+   
+      numBins = max(ctl_bins,stim_bins);  // really should be same if we have both
+      currCycle = 0;
+      cyclePhase = 0.0;
+      if (numBins)
+         phrenicStep = double(PHRENIC_E_END - PHRENIC_I_START)/numBins;
+      else
+         phrenicStep = 0;
+      if (new_file)   // experiment changes reuse the cells
+         gatherCells(dispCells,sibCells);
+
+         // Each cluster's cells go in the cell table one period list after
+         // another, the shader colors them from the CTH table as it draws.
+      job = make_shared<cellUpload>();
+      job->generation = ++uploadGen;
+      for (curr_clust = 0; curr_clust < num_clusts; ++curr_clust)
+      {
+         glCTH point = {};
+         for (int list = CONTROL_COLORS; list < DELTA_COLORS; ++list)
+         {
+            point.first[list] = job->cells.size();
+              // not all periods are in every cluster, so check for this
+            auto block = cthColors[list].find(curr_clust);
+            if (block != cthColors[list].end())
+               visibleCells(block->second,exp_on_off,job->cells,job->cths);
+            point.cellSize[list] = job->cells.size() - point.first[list];
+         }
+         job->ranges[curr_clust] = point;
+      }
 
       if (haveDelta)
       {
          GLuint colsiz = deltaShadeTab.size() * sizeof(glm::vec4);
-         glUseProgram(cellProg);
+         glUseProgram(cellProgs[MONO_VIEW]);
          glBindBuffer(GL_SHADER_STORAGE_BUFFER,deltaTabVbo);
          glBufferData(GL_SHADER_STORAGE_BUFFER,colsiz,nullptr,GL_STATIC_DRAW);
          glBindBufferRange(GL_SHADER_STORAGE_BUFFER, 3, deltaTabVbo, 0, colsiz);
@@ -1427,73 +2205,36 @@ void BrainStemGL::updateCells(bool new_file, bool exp_chg, bool delta_cths,
          glUseProgram(0);
          glBindBuffer(GL_SHADER_STORAGE_BUFFER,0);
 
-         citerdelta = dispCells[DELTA_COLORS].find(0); // no clusters, just 1 set
-         if (citerdelta != dispCells[DELTA_COLORS].end())
-         {
-              // do DELTA period coords & colors 
-            for (cell=citerdelta->second.begin(); cell != citerdelta->second.end(); ++cell)
-            {
-               if (cell->rl == 0.0 && cell->dp == 0.0 && cell->ap == 0.0)
-                  continue;
-               if ((exp_on_off.size() == 0) || exp_on_off[cell->expidx])
-               {
-                  cthCoords[DELTA_PTS].push_back(glm::vec3(cell->rl, -cell->dp, -cell->ap));
-                  cthColorIdx[DELTA_COLORS][0].push_back(D_COLOR_STEPS-1); // default
-               }
-            }
-            for (curr_bin=0,rows = 1; rows <= numBins; ++curr_bin,++rows)
-            {
-               for (ClusterIter deltaiter=citerdelta->second.begin(); deltaiter != citerdelta->second.end(); ++deltaiter)
-               {
-                  deltaval = deltaiter->normCth[curr_bin];
-                  if (deltaval >= 0)
-                     coloridx = floor(D_COLOR_STEPS - (deltaval*D_COLOR_STEPS));
-                  else
-                     coloridx = ceil((D_COLOR_STEPS+1) - (deltaval*D_COLOR_STEPS));
-                  cthColorIdx[DELTA_COLORS][rows].push_back(coloridx);
-               }
-            }
-         }
-         for (set = 0; set < tot_vaos; ++set)  // now send to opengl
-         {
-            glGenVertexArrays(1,&newVao);
-            glBindVertexArray(newVao);
-
-            glBindBuffer(GL_ARRAY_BUFFER,sphere_pt_vbo); // sphere vertex coords
-            glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 0, nullptr);
-            glEnableVertexAttribArray(0);
-            glBindBuffer(GL_ARRAY_BUFFER,sphere_norm_vbo); // sphere normals
-            glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, 0, nullptr);
-            glEnableVertexAttribArray(1);
-
-            d_coord_bytes = cthCoords[DELTA_PTS].size() * sizeof(glm::vec3); 
-            d_color_bytes = cthColorIdx[DELTA_COLORS][0].size() * sizeof(coloridx);
-            glGenBuffers(1,&delta_pt_vbo);       // cell coords
-            glBindBuffer(GL_ARRAY_BUFFER,delta_pt_vbo);
-            glBufferData(GL_ARRAY_BUFFER,d_coord_bytes,cthCoords[DELTA_PTS].data(),GL_STATIC_DRAW);
-            glVertexAttribPointer(4, 3, GL_FLOAT, GL_FALSE, 0, nullptr);
-            glEnableVertexAttribArray(4);
-            glVertexAttribDivisor(4,1); // 1 position per sphere instance
-
-            glGenBuffers(1,&delta_color_vbo);       // cell color indexes
-            glBindBuffer(GL_ARRAY_BUFFER,delta_color_vbo);
-            glBufferData(GL_ARRAY_BUFFER,d_color_bytes,cthColorIdx[DELTA_COLORS][set].data(),GL_STATIC_DRAW);
-            glVertexAttribIPointer(7, 1, GL_INT, 0, nullptr);
-            glEnableVertexAttribArray(7);
-            glVertexAttribDivisor(7,1); // 1 color index per sphere instance
-
-             // we become the last "cluster"
-            glCTH point = {newVao,0,0,0,0,cthCoords[DELTA_PTS].size()};
-            cellsVao[curr_clust].push_back(point);
-         }
+         glCTH point = {};
+         point.first[DELTA_PTS] = job->cells.size();
+         auto block = cthColors[DELTA_COLORS].find(0); // no clusters, just 1 set
+         if (block != cthColors[DELTA_COLORS].end())
+            visibleCells(block->second,exp_on_off,job->cells,job->cths);
+         point.cellSize[DELTA_PTS] = job->cells.size() - point.first[DELTA_PTS];
+         job->ranges[curr_clust] = point;   // we become the last "cluster"
+      }
+
+      if (Debug)
+      {
+         QTextStream(&msg) << "Cell table: " << job->cells.size() << " cells, " 
+                           << job->cths.size() << " CTH values";
+         emit(chatBox(msg));
       }
 
+        // the CTHs go over once, color cycling only changes the phase
+      if (uploadThread)
+      {
+         uploadJobs.push_back(job);
+         emit(uploadCells(job));   // swapped in when they're on the gpu
+      }
+      else
+      {
+         uploader->send(*job);
+         swapCells(job);
+      }
       doneCurrent();
-      glBindVertexArray(0);               // nothing in scope
-      glBindBuffer(GL_ARRAY_BUFFER,0);
-      glUseProgram(0);
    }
-   update();
+   cellsUpdate();
 }
 
 void BrainStemGL::closeFile()
@@ -1501,6 +2242,8 @@ void BrainStemGL::closeFile()
    makeCurrent();
    clearClusts();
    doneCurrent();
+   for (auto& list : cthColors)
+      list.clear();
    clearInfo();
 }
 
@@ -1520,6 +2263,9 @@ void BrainStemGL::createShades(ClustRGB& rgbClustMap)
    colorBright shade;
    glm::vec3 gamma(1.0/2.2);
 
+   colorTab.clear();
+   oneShadeTab.clear();
+   deltaShadeTab.clear();
    one_hsv = glm::hsvColor(glm::vec3(0.0,1.0,0.0)); // all green shades
    step = one_hsv.z / (COLOR_STEPS-1);
    for (bright = 0 ; bright < COLOR_STEPS; ++bright)
@@ -1602,7 +2348,7 @@ void BrainStemGL::createShades(ClustRGB& rgbClustMap)
 void BrainStemGL::updateCellProg()
 {
    GLuint colsiz = colorTab.size() * sizeof(glm::vec4);
-   glUseProgram(cellProg);
+   glUseProgram(cellProgs[MONO_VIEW]);
    glBindBuffer(GL_SHADER_STORAGE_BUFFER,colorTabVbo);
    glBufferData(GL_SHADER_STORAGE_BUFFER,colsiz,nullptr,GL_STATIC_DRAW);
    glBindBufferRange(GL_SHADER_STORAGE_BUFFER, 2, colorTabVbo, 0, colsiz);
@@ -1615,365 +2361,881 @@ void BrainStemGL::updateCellProg()
 }
 
 
-// free up vaos and their vbos
+// free up the cells and their color tables, and forget any upload in flight
 void BrainStemGL::clearClusts()
 {
-   GLint numVbos;
-   GLuint vboId = 0;
-   GLuint curr_vao;
+   freeCells();
+   colorTab.clear();
+   oneShadeTab.clear();
+   deltaShadeTab.clear();
+   numBins = 0;
+   phrenicLinePos = PHRENIC_I_START;
+   ++uploadGen;
+}
+
+// free up the cell vao and its buffers
+void BrainStemGL::freeCells()
+{
+   GLuint vbos[] = {cellRowVbo, cellTabVbo, cthTabVbo, lodInitVbo, lodDrawVbo, lodRowVbo};
+   GLuint vaos[] = {cellVao, cellLodVao};
+
+   glDeleteVertexArrays(2,vaos);
+   cellVao = cellLodVao = 0;
+   glDeleteBuffers(6,vbos);    // zeros are ignored
+   cellRowVbo = cellTabVbo = cthTabVbo = 0;
+   lodInitVbo = lodDrawVbo = lodRowVbo = 0;
+   lodListCount = lodCellCount = 0;
+   cellRows.clear();
+}
+
+// Delete an upload's buffers and fence, for one that won't be drawn.
+// Assumes caller has done a makeCurrent call
+void BrainStemGL::freeUpload(cellUpload& job)
+{
+   GLuint vbos[] = {job.rowVbo, job.cellTabVbo, job.cthTabVbo};
+
+   if (job.fence)
+      glDeleteSync(job.fence);
+   job.fence = nullptr;
+   glDeleteBuffers(3,vbos);    // zeros are ignored
+   job.rowVbo = job.cellTabVbo = job.cthTabVbo = 0;
+}
+
+// An upload is ready.  Have the gpu wait for its buffers, then draw
+// them instead of the cells we have now.
+// Vaos aren't shared between contexts, so the cell vao is made here.
+void BrainStemGL::swapCells(cellUploadPtr job)
+{
+   GLenum err_chk;
+
+   uploadJobs.erase(remove(uploadJobs.begin(),uploadJobs.end(),job),uploadJobs.end());
+   if (!job->cellTabVbo)   // never sent
+   {
+      emit(chatBox("Could not upload the cells, the upload thread has no context."));
+      return;
+   }
+   makeCurrent();
+   if (job->fence)
+   {
+      glWaitSync(job->fence,0,GL_TIMEOUT_IGNORED);
+      glDeleteSync(job->fence);
+      job->fence = nullptr;
+   }
+   if (job->generation != uploadGen)   // closed, or newer cells on the way
+   {
+      freeUpload(*job);
+      doneCurrent();
+      return;
+   }
+
+   freeCells();
+   cellRowVbo = job->rowVbo;
+   cellTabVbo = job->cellTabVbo;
+   cthTabVbo = job->cthTabVbo;
+   glBindBufferBase(GL_SHADER_STORAGE_BUFFER,4,cellTabVbo);
+   glBindBufferBase(GL_SHADER_STORAGE_BUFFER,5,cthTabVbo);
+
+   cellRows = job->ranges;
+   lodLists();
+
+     // The sphere is shared by all cells. Row numbers are 1 per sphere
+     // instance, the hard-wired 2 has to match the location in the cell
+     // shaders. Drawing a list with its first row as the base instance
+     // starts this at that row. Culled cells take theirs from the cull pass.
+   GLuint row_vbos[] = {cellRowVbo, lodRowVbo};
+   GLuint *vaos[] = {&cellVao, &cellLodVao};
+   for (int vao = 0; vao < 2 && row_vbos[vao]; ++vao)
+   {
+      glGenVertexArrays(1,vaos[vao]);
+      glBindVertexArray(*vaos[vao]);
+      glBindBuffer(GL_ARRAY_BUFFER,sphereVertVbo);
+      glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, 0, nullptr);
+      glEnableVertexAttribArray(0);
+      glBindBuffer(GL_ARRAY_BUFFER,sphereNormVbo);
+      glVertexAttribPointer(1, 3, GL_FLOAT, GL_FALSE, 0, nullptr);
+      glEnableVertexAttribArray(1);
+      glBindBuffer(GL_ARRAY_BUFFER,row_vbos[vao]);
+      glVertexAttribIPointer(2, 1, GL_INT, 0, nullptr);
+      glEnableVertexAttribArray(2);
+      glVertexAttribDivisor(2,1);
+   }
+   glBindVertexArray(0);
+   glBindBuffer(GL_ARRAY_BUFFER,0);
+
+   for (GLuint prog : cellPrograms())
+      glProgramUniform1i(prog,7,numBins);
+   err_chk = glGetError();
+   if (err_chk != 0)
+      cout << "swap cells error is: " << err_chk << endl;
+   doneCurrent();
+   cellsUpdate();
+}
+
+// apply current rotations, translations, and redraw objects
+void BrainStemGL::paintGL()
+{
+   GLenum err_chk;
+   glm::mat4 T1, T2, T2_3D, RX, RY, RY_3D, RZ;
+
+// clock_gettime(CLOCK_MONOTONIC,&frameStart);
+
+        // Various translation, rotation calcs
+   float view_roty_3D = view_roty + 5.0;
+   if (view_roty_3D >= 360.0)
+      view_roty_3D -= 360.0;
+      // model to world origin
+   T1 = glm::translate(glm::mat4(1.0f),glm::vec3(-xmid,-ymid,-zmid));
+      // spin it 
+   RX  = glm::rotate(glm::mat4(1.0f),glm::radians(view_rotx),glm::vec3(1.0,0.0,0.0));
+      // Y is fixed rotation + angle if animating
+   RY  = glm::rotate(glm::mat4(1.0f),glm::radians(view_roty+angle),glm::vec3(0.0,1.0,0.0));
+      // Y rotation for 3D viewing
+   RY_3D = glm::rotate(glm::mat4(1.0f),glm::radians(view_roty_3D+angle),glm::vec3(0.0,1.0,0.0));
+   RZ  = glm::rotate(glm::mat4(1.0f),glm::radians(view_rotz),glm::vec3(0.0,0.0,1.0));
+     // back to model position
+   T2 = glm::translate(glm::mat4(1.0f),glm::vec3(view_trx,view_try,view_trz));
+   T2_3D = glm::translate(glm::mat4(1.0f),glm::vec3(-view_trx,view_try,view_trz));
+
+   switch(stereoMode)
+   {
+      case CONTROL_STEREO:  // do Y rotation offset
+      case STIM_STEREO:
+      case DELTA_STEREO:
+      case CTRLSIB_STEREO:
+      case STIMSIB_STEREO:
+         RY_3D = glm::rotate(glm::mat4(1.0f),glm::radians(view_roty_3D+angle),glm::vec3(0.0,1.0,0.0));
+         break;
+
+      case CTRL_STIM_PAIR:   // no Y offset
+      case CONTROL_ONLY:
+      case STIM_ONLY:
+      case DELTA_ONLY:
+      case CTRLSIB_PAIR:
+      case CTRLSIB_ONLY:
+      case STIMSIB_PAIR:
+      case STIMSIB_ONLY:
+      default:
+          RY_3D  = glm::rotate(glm::mat4(1.0f),glm::radians(view_roty+angle),glm::vec3(0.0,1.0,0.0));
+   }
+
+   modelMat[0] = T2 * RX * RY * RZ * T1;            // std model
+   mvpMat[0] = projMat * viewMat * modelMat[0]; 
+   modelMat[1] = T2_3D * RX * RY_3D * RZ * T1;      // 3D model
+   mvpMat[1] = projMat * viewMat * modelMat[1];
+   mvMat[0] = viewMat * modelMat[0];   // normals
+   mvMat[1] = viewMat * modelMat[1];
+
+   if (stereoViewports == 1)   // 1 or 2 viewports
+      glViewport(0,0,geometry().width(),geometry().height()); 
+   else
+   {
+      glViewportIndexedf(0, 0.0, 0.0, viewPortW, viewPortH);
+      glViewportIndexedf(1, geometry().width() - viewPortW, 0.0, viewPortW, viewPortH);
+   }
+
+     // send all this info to shaders, using a ring slot the gpu is done with
+   nextFrameSlot();
+   GLintptr slot = frameSlot * frameSlotSize;
+   if (frameRingPtr)
+   {
+      memcpy(frameRingPtr + slot + mvpOffset,&mvpMat,mvpSize);
+      memcpy(frameRingPtr + slot + mvOffset,&mvMat,mvSize);
+      memset(frameRingPtr + slot + counterOffset,0,sizeof(GLuint));
+   }
+   else
+   {
+      GLuint zero = 0;
+      glBindBuffer(GL_UNIFORM_BUFFER,frameRingBuff);
+      glBufferSubData(GL_UNIFORM_BUFFER,slot + mvpOffset,mvpSize,&mvpMat);
+      glBufferSubData(GL_UNIFORM_BUFFER,slot + mvOffset,mvSize,&mvMat);
+      glBufferSubData(GL_UNIFORM_BUFFER,slot + counterOffset,sizeof(zero),&zero);
+   }
+   glBindBufferRange(GL_UNIFORM_BUFFER,vUboBlkId,frameRingBuff,slot + mvpOffset,mvpSize);
+   glBindBufferRange(GL_UNIFORM_BUFFER,nUboBlkId,frameRingBuff,slot + mvOffset,mvSize);
+   glBindBufferRange(GL_ATOMIC_COUNTER_BUFFER,0,frameRingBuff,slot + counterOffset,sizeof(GLuint));
+   frameLights(slot);
+   err_chk = glGetError();
+   if (err_chk != 0)
+       cout << "paint error 1 is: " << err_chk << endl;
+
+    // Opaque things go first, straight into the framebuffer with a real
+    // depth buffer. Lines are always opaque, skin, structures, and cells
+    // are if they are not see through. Anything fully transparent adds
+    // nothing, so it is not drawn at all.
+   bool show_skin = skinOn && skinTrans > 0.0;
+   bool show_structs = structsFirst.size() > 0 && regionTrans > 0.0;
+   bool opaque_skin = skinTrans >= 1.0;
+   bool opaque_structs = regionTrans >= 1.0;
+   bool opaque_cells = cellTrans >= 1.0;
+   transPrint = twinkleOn || spinOn || printClear;
+   transSkin = show_skin && !opaque_skin;
+   transStructs = show_structs && !opaque_structs;
+   transCells = cellRows.size() && !opaque_cells;
+   if (showOutlines && !outlinesVao)   // made the first time they're shown
+      outlines();
+   if (show_structs && !structVao)
+      stemStructs();
+
+     // Color cycling with nothing else changed, the lists from the last
+     // frame are still good, only the colors of the cells in them change
+   deferCells = transCells && numBins && !hideCells && oitEngine == OIT_LISTS
+                && tileResolve && oitTex[LIST_OPAQUE];
+   if (deferCells && listsDeferred && !listsStale)
+   {
+      recolorLists();
+      endFrame();
+      return;
+   }
+   listsStale = false;
+
+     // The skin and structures' lists can be kept while only the cells
+     // change, unless opaque cells hide some of them
+   staticLists = (oitEngine == OIT_LISTS || oitEngine == OIT_KBUFFER) && (transSkin || transStructs)
+                 && !(cellRows.size() && opaque_cells);
+   if (!staticLists)
+      staticStale = true;
+   useImpostors = impostorCells && cellImpProgs[MONO_VIEW];
+   if (lodDrawVbo)
+      cullCells();
+   glEnable(GL_DEPTH_TEST);
+   glDepthMask(GL_TRUE);
+   glDisable(GL_CULL_FACE);
+   glDisable(GL_BLEND);
+   glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+
+   if (showOutlines)
+   {
+      glEnable(GL_PRIMITIVE_RESTART); // <- pre 4.5 opengl used this for non-indexed
+      glUseProgram(outlineProgs[stereoView]); // draws, which it should not because it clobbers 
+      glBindVertexArray(outlinesVao); // at least one structure object, so leave it off 
+                                      // until we use it, then turn it back off.
+      glBindBuffer(GL_ELEMENT_ARRAY_BUFFER,outlinesIdx); //  until we need it
+      glDrawElementsInstanced(GL_LINE_LOOP,outlinesIdxSize,GL_UNSIGNED_INT,nullptr,viewInstances);
+      glDisable(GL_PRIMITIVE_RESTART);
+   }
+
+   if (showAxes)
+   {
+      glUseProgram(axesProgs[stereoView]);
+      glBindVertexArray(axesVao);
+      glDrawArraysInstanced(GL_LINES,0,axesSize,viewInstances);
+   }
+
+     // skin is outermost, so it goes first to reject more of what is inside
+   if (show_skin && opaque_skin)
+      paintSkin(true);
+   if (show_structs && opaque_structs)
+      paintStructs(true);
+   if (opaque_cells)
+      paintCells(true);
+
+   err_chk = glGetError();
+   if (err_chk != 0)
+      cout << "paint error 2 is: " << err_chk << endl;
+
+     // Impostors write their own depth, so they can't test it early. In
+     // the lists they test it against a copy of the opaque pass's.
+   if (useImpostors && transCells && (oitEngine == OIT_LISTS || oitEngine == OIT_KBUFFER))
+   {
+      useImpostors = oitDepthTex && copyDepth();
+      if (!useImpostors && lodDrawVbo)   // meshes need their own draws
+         cullCells();
+      glBindFramebuffer(GL_FRAMEBUFFER,defaultFramebufferObject());
+   }
+
+   if (deferCells)   // kept for recolorLists()
+   {
+      glBindFramebuffer(GL_READ_FRAMEBUFFER,defaultFramebufferObject());
+      glBindFramebuffer(GL_DRAW_FRAMEBUFFER,oitFbo);
+      glDrawBuffer(GL_COLOR_ATTACHMENT0+LIST_OPAQUE);
+      glBlitFramebuffer(0,0,oitTexW,oitTexH,0,0,oitTexW,oitTexH,GL_COLOR_BUFFER_BIT,GL_NEAREST);
+      glBindFramebuffer(GL_FRAMEBUFFER,defaultFramebufferObject());
+   }
+
+   if (transPrint || transSkin || transStructs || transCells)
+   {
+       // Translucent pass, fragments behind opaque things fail the depth test
+      glDepthMask(GL_FALSE);
+      if ((oitEngine == OIT_WEIGHTED || oitEngine == OIT_PEEL) && !copyDepth())
+      {
+         emit(chatBox("Can't copy the depth buffer, using per-pixel lists for transparency."));
+         oitEngine = OIT_LISTS;     // already current, don't use setOitEngine()
+         oitTargets(geometry().width(),geometry().height());
+         oitPool(geometry().width(),geometry().height());
+      }
+      switch (oitEngine)
+      {
+         case OIT_WEIGHTED:
+            paintWeighted();
+            break;
+         case OIT_PEEL:
+            paintPeeled();
+            break;
+         case OIT_LISTS:
+         case OIT_KBUFFER:
+         default:
+            paintLists();
+      }
+      if (deferCells && transPrint)
+         paintOver();
+      glDepthMask(GL_TRUE);
+      printClear = false;
+   }
+   listsDeferred = deferCells;
+   glDisable(GL_DEPTH_TEST);
+
+   err_chk = glGetError();
+   if (err_chk != 0)
+      cout << "paint error 4 is: " << err_chk << endl;
+
+   endFrame();
+
+//clock_gettime(CLOCK_MONOTONIC,&frameEnd);
+//interval = (frameEnd.tv_sec*1000*1000*1000 + frameEnd.tv_nsec) - (frameStart.tv_sec*1000*1000*1000 + frameStart.tv_nsec);
+//cout << "Repaint time: " << (unsigned long)(interval/(1000.0 * 1000.0)) << endl;
+}
+
+// Unbind everything and fence off this frame's ring slot
+void BrainStemGL::endFrame()
+{
+   glBindBuffer(GL_ELEMENT_ARRAY_BUFFER,0); // nothing in scope
+   glBindVertexArray(0);
+   glUseProgram(0);
+   glBindTexture(GL_TEXTURE_2D,0);
+   glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+
+     // mark when the gpu is done with this ring slot
+   frameFence[frameSlot] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE,0);
+   if (counterCopied[frameSlot] && !oitPolling)
+   {
+      oitPolling = true;
+      QTimer::singleShot(OIT_POLL_MS,this,&BrainStemGL::pollOitCount);
+   }
+}
+
+// Only the cell colors changed since the lists were built, they hold the
+// cells as rows. Put back the opaque pass, resolve the lists again at this
+// phase, and put the info box on top. One pass over the window instead of
+// drawing everything again.
+void BrainStemGL::recolorLists()
+{
+   GLenum err_chk;
+
+   glBindFramebuffer(GL_READ_FRAMEBUFFER,oitFbo);
+   glReadBuffer(GL_COLOR_ATTACHMENT0+LIST_OPAQUE);
+   glBindFramebuffer(GL_DRAW_FRAMEBUFFER,defaultFramebufferObject());
+   glBlitFramebuffer(0,0,oitTexW,oitTexH,0,0,oitTexW,oitTexH,GL_COLOR_BUFFER_BIT,GL_NEAREST);
+   glBindFramebuffer(GL_FRAMEBUFFER,defaultFramebufferObject());
+   glDisable(GL_DEPTH_TEST);
+   glEnable(GL_BLEND);
+   glBlendFunc(GL_ONE, GL_ONE_MINUS_SRC_ALPHA);    // resolve is premultiplied
+   resolveTiles();
+   glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA); 
+   glDisable(GL_BLEND);
+   if (transPrint)
+      paintOver();
+   printClear = false;
+
+   err_chk = glGetError();
+   if (err_chk != 0)
+      cout << "recolor error is: " << err_chk << endl;
+}
+
+// The info box changes every bin, so when the lists are kept for recoloring
+// it is not in them. It is nearer than everything, so it goes on top.
+void BrainStemGL::paintOver()
+{
+   glDisable(GL_DEPTH_TEST);
+   glEnable(GL_BLEND);
+   glBlendFuncSeparate(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA, GL_ONE, GL_ONE_MINUS_SRC_ALPHA);
+   glProgramUniform1i(printProg,20,OVER_PASS);
+   glUseProgram(printProg);
+   glBindVertexArray(printVao);
+   glActiveTexture(GL_TEXTURE0);
+   glBindTexture(GL_TEXTURE_2D,printText);
+   glDrawArrays(GL_TRIANGLES,0,sizeText);
+   glBindTexture(GL_TEXTURE_2D,0);
+   glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA); 
+   glDisable(GL_BLEND);
+}
+
+// Draw everything in this frame's translucent layer, for whatever pass
+// the transparency engine is on
+void BrainStemGL::paintTranslucent()
+{
+   paintStaticLayer();
+   paintDynamicLayer();
+}
+
+// The part of the translucent layer that only changes with the camera or
+// the scene
+void BrainStemGL::paintStaticLayer()
+{
+   if (transSkin)
+      paintSkin(false);
+   if (transStructs)
+      paintStructs(false);
+}
+
+// And the part that changes with the cells and the info box
+void BrainStemGL::paintDynamicLayer()
+{
+   if (transPrint && !deferCells)
+   {
+      glUseProgram(printProg);
+      glBindVertexArray(printVao);
+      glActiveTexture(GL_TEXTURE0);
+      glBindTexture(GL_TEXTURE_2D,printText);
+      glDrawArrays(GL_TRIANGLES,0,sizeText);
+      glBindTexture(GL_TEXTURE_2D,0);
+   }
+   if (transCells)
+      paintCells(false);
+}
+
+// The skin and structures are most of the fragments in the lists, but
+// cluster toggles, hiding, point size, and color cycling only change the
+// cells. So their lists are kept, the head pointers in staticHeadTex and
+// the nodes at the start of the pool, until the camera or the scene
+// changes. A frame starts from a copy of them, and the cells and info box
+// go on the front of the lists.
+void BrainStemGL::staticLayer()
+{
+   double dpr = devicePixelRatioF();
+   GLsizei w = min(GLsizei(geometry().width()*dpr),GLsizei(MAX_FB_WIDTH));
+   GLsizei h = min(GLsizei(geometry().height()*dpr),GLsizei(MAX_FB_HEIGHT));
+   GLintptr counter = frameSlot*frameSlotSize + counterOffset;
+   GLenum err_chk;
+
+   if (staticStale)
+   {
+      clearHeads();
+      paintStaticLayer();
+      glMemoryBarrier(GL_TEXTURE_UPDATE_BARRIER_BIT | GL_BUFFER_UPDATE_BARRIER_BIT);
+      glCopyImageSubData(headPointerTex,GL_TEXTURE_2D,0,0,0,0,
+                         staticHeadTex,GL_TEXTURE_2D,0,0,0,0,w,h,1);
+      glBindBuffer(GL_COPY_READ_BUFFER,frameRingBuff);
+      glBindBuffer(GL_COPY_WRITE_BUFFER,staticCountBuff);
+      glCopyBufferSubData(GL_COPY_READ_BUFFER,GL_COPY_WRITE_BUFFER,counter,0,sizeof(GLuint));
+      staticStale = false;
+   }
+   else
+   {
+      glCopyImageSubData(staticHeadTex,GL_TEXTURE_2D,0,0,0,0,
+                         headPointerTex,GL_TEXTURE_2D,0,0,0,0,w,h,1);
+      glBindBuffer(GL_COPY_READ_BUFFER,staticCountBuff);
+      glBindBuffer(GL_COPY_WRITE_BUFFER,frameRingBuff);
+      glCopyBufferSubData(GL_COPY_READ_BUFFER,GL_COPY_WRITE_BUFFER,0,counter,sizeof(GLuint));
+   }
+   glBindBuffer(GL_COPY_READ_BUFFER,0);
+   glBindBuffer(GL_COPY_WRITE_BUFFER,0);
+   err_chk = glGetError();
+   if (err_chk != 0)
+      cout << "static layer error is: " << err_chk << endl;
+}
+
+// Per-pixel linked lists, sorted and blended by the second pass. All of
+// each list by the compute resolve, or for the k-buffer just the nearest
+// kBufferSize.
+void BrainStemGL::paintLists()
+{
+   GLenum err_chk;
+
+   oitPass(LIST_PASS);
+   glColorMask(GL_FALSE,GL_FALSE,GL_FALSE,GL_FALSE);
+   if (staticLists)
+   {
+      staticLayer();
+      paintDynamicLayer();
+   }
+   else
+   {
+      clearHeads();
+      paintTranslucent();
+   }
+   glColorMask(GL_TRUE,GL_TRUE,GL_TRUE,GL_TRUE);
+   err_chk = glGetError();
+   if (err_chk != 0)
+      cout << "paint error 3 is: " << err_chk << endl;
 
-   if (cellsVao.size())
+     // how many nodes this frame wanted, read when its ring slot comes round
+   glMemoryBarrier(GL_BUFFER_UPDATE_BARRIER_BIT);
+   glBindBuffer(GL_COPY_READ_BUFFER,frameRingBuff);
+   glBindBuffer(GL_COPY_WRITE_BUFFER,counterReadBuff);
+   glCopyBufferSubData(GL_COPY_READ_BUFFER,GL_COPY_WRITE_BUFFER,frameSlot*frameSlotSize + counterOffset,
+                       frameSlot*sizeof(GLuint),sizeof(GLuint));
+   glBindBuffer(GL_COPY_READ_BUFFER,0);
+   glBindBuffer(GL_COPY_WRITE_BUFFER,0);
+   counterCopied[frameSlot] = true;
+
+       // second pass, sort the lists and blend them over the opaque pass
+   glFlush();                                      // tell the above to complete
+   glMemoryBarrier(GL_SHADER_STORAGE_BARRIER_BIT | GL_SHADER_IMAGE_ACCESS_BARRIER_BIT); // then wait for it
+   glDisable(GL_DEPTH_TEST);
+   glEnable(GL_BLEND);
+   glBlendFunc(GL_ONE, GL_ONE_MINUS_SRC_ALPHA);    // resolve is premultiplied
+   if (oitEngine == OIT_LISTS && tileResolve)
+      resolveTiles();
+   else
    {
-      glGetIntegerv(GL_MAX_VERTEX_ATTRIBS,&numVbos);
-      for (vaoCellListIter iter = cellsVao.begin(); iter != cellsVao.end(); ++iter)
-      {
-         for (curr_vao = 0; curr_vao < iter->second.size(); ++curr_vao)
-         {
-            glBindVertexArray(iter->second[curr_vao].vao);
-            for (int id = 0; id < numVbos; ++id)
-            {
-               vboId = 0;
-               glGetVertexAttribIuiv(id,GL_VERTEX_ATTRIB_ARRAY_BUFFER_BINDING,&vboId);
-               if (vboId)
-                  glDeleteBuffers(1,&vboId);
-            } 
-            glDeleteVertexArrays(1,&(iter->second[curr_vao].vao));
-         }
-      }
-      cellsVao.clear();
-      colorTab.clear();
-      oneShadeTab.clear();
-      deltaShadeTab.clear();
-      numBins = 0;
-      phrenicLinePos = PHRENIC_I_START;
+      if (oitEngine == OIT_KBUFFER)
+         glUseProgram(kBufferProgs[stereoView]);
+      else
+         glUseProgram(finalRenderProgs[stereoView]);
+      glBindVertexArray(showVao);
+      glDrawArraysInstanced(GL_TRIANGLE_STRIP,0,4,viewInstances);
    }
+   glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA); 
+   glDisable(GL_BLEND);
 }
 
-
-
-// apply current rotations, translations, and redraw objects
-void BrainStemGL::paintGL()
+// Resolve the lists in compute shaders. The first pass bins the window's
+// tiles by their longest list. Then each bin is dispatched to a sort sized
+// for it: empty tiles are skipped, short and medium lists insertion sort in
+// registers, long ones merge sort in shared memory. Most of a typical frame
+// is empty or a few layers deep, so few pixels pay for the deep ones.
+void BrainStemGL::resolveTiles()
 {
-   int idx;
-   GLuint *texdata;
+     // counts start at 0, a long tile is a group per pixel
+   const GLuint reset[TILE_CLASSES][3] = {{0,1,1}, {0,1,1}, {0,1,1}, {0,OIT_TILE*OIT_TILE,1}};
+   double dpr = devicePixelRatioF();
+   GLint w = min(GLint(geometry().width()*dpr),GLint(MAX_FB_WIDTH));
+   GLint h = min(GLint(geometry().height()*dpr),GLint(MAX_FB_HEIGHT));
    GLenum err_chk;
-   glm::mat4 T1, T2, T2_3D, RX, RY, RY_3D, RZ;
-
-// clock_gettime(CLOCK_MONOTONIC,&frameStart);
 
-        // Various translation, rotation calcs
-   float view_roty_3D = view_roty + 5.0;
-   if (view_roty_3D >= 360.0)
-      view_roty_3D -= 360.0;
-      // model to world origin
-   T1 = glm::translate(glm::mat4(1.0f),glm::vec3(-xmid,-ymid,-zmid));
-      // spin it 
-   RX  = glm::rotate(glm::mat4(1.0f),glm::radians(view_rotx),glm::vec3(1.0,0.0,0.0));
-      // Y is fixed rotation + angle if animating
-   RY  = glm::rotate(glm::mat4(1.0f),glm::radians(view_roty+angle),glm::vec3(0.0,1.0,0.0));
-      // Y rotation for 3D viewing
-   RY_3D = glm::rotate(glm::mat4(1.0f),glm::radians(view_roty_3D+angle),glm::vec3(0.0,1.0,0.0));
-   RZ  = glm::rotate(glm::mat4(1.0f),glm::radians(view_rotz),glm::vec3(0.0,0.0,1.0));
-     // back to model position
-   T2 = glm::translate(glm::mat4(1.0f),glm::vec3(view_trx,view_try,view_trz));
-   T2_3D = glm::translate(glm::mat4(1.0f),glm::vec3(-view_trx,view_try,view_trz));
+   glBindBuffer(GL_SHADER_STORAGE_BUFFER,tileBinBuff);
+   glBufferSubData(GL_SHADER_STORAGE_BUFFER,0,sizeof(reset),reset);
+   glBindBuffer(GL_SHADER_STORAGE_BUFFER,0);
+   glUseProgram(tileClassProg);
+   glUniform2i(0,w,h);
+   glDispatchCompute((w+OIT_TILE-1)/OIT_TILE,(h+OIT_TILE-1)/OIT_TILE,1);
+   glMemoryBarrier(GL_SHADER_STORAGE_BARRIER_BIT | GL_COMMAND_BARRIER_BIT);
 
-   switch(stereoMode)
+   glBindBuffer(GL_DISPATCH_INDIRECT_BUFFER,tileBinBuff);
+   for (int cls = TILE_SHORT; cls < TILE_CLASSES; ++cls)
    {
-      case CONTROL_STEREO:  // do Y rotation offset
-      case STIM_STEREO:
-      case DELTA_STEREO:
-      case CTRLSIB_STEREO:
-      case STIMSIB_STEREO:
-         RY_3D = glm::rotate(glm::mat4(1.0f),glm::radians(view_roty_3D+angle),glm::vec3(0.0,1.0,0.0));
-         break;
-
-      case CTRL_STIM_PAIR:   // no Y offset
-      case CONTROL_ONLY:
-      case STIM_ONLY:
-      case DELTA_ONLY:
-      case CTRLSIB_PAIR:
-      case CTRLSIB_ONLY:
-      case STIMSIB_PAIR:
-      case STIMSIB_ONLY:
-      default:
-          RY_3D  = glm::rotate(glm::mat4(1.0f),glm::radians(view_roty+angle),glm::vec3(0.0,1.0,0.0));
+      glUseProgram(tileSortProg[cls]);
+      glUniform2i(0,w,h);
+      glUniform1f(1,useImpostors ? cellTrans * (2.0 - cellTrans) : cellTrans);  // deferred cells, see cellFSrc
+      glUniform1f(6,currCycle ? cyclePhase : -1.0);
+      glUniform1i(7,numBins);
+      glDispatchComputeIndirect(GLintptr(sizeof(reset[0])) * cls);
    }
+   glBindBuffer(GL_DISPATCH_INDIRECT_BUFFER,0);
+   glMemoryBarrier(GL_TEXTURE_FETCH_BARRIER_BIT);
+   err_chk = glGetError();
+   if (err_chk != 0)
+      cout << "tile resolve error is: " << err_chk << endl;
 
-   modelMat[0] = T2 * RX * RY * RZ * T1;            // std model
-   mvpMat[0] = projMat * viewMat * modelMat[0]; 
-   modelMat[1] = T2_3D * RX * RY_3D * RZ * T1;      // 3D model
-   mvpMat[1] = projMat * viewMat * modelMat[1];
-   mvMat[0] = viewMat * modelMat[0];   // normals
-   mvMat[1] = viewMat * modelMat[1];
-
-   if (stereoViewports == 1)   // 1 or 2 viewports
-      glViewport(0,0,geometry().width(),geometry().height()); 
-   else
-   {
-      glViewportIndexedf(0, 0.0, 0.0, viewPortW, viewPortH);
-      glViewportIndexedf(1, geometry().width() - viewPortW, 0.0, viewPortW, viewPortH);
-   }
+   compose(3,resolveTex,tileUsedTex);
+}
 
-     // send all this info to shaders
-   glBindBufferBase(GL_UNIFORM_BUFFER,vUboBlkId,vUboBuff);
-   unsigned char* mvp_ptr = (unsigned char*) glMapBufferRange(GL_UNIFORM_BUFFER,0,mvpSize,
-                             GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT);
-   memcpy(mvp_ptr,&mvpMat,mvpSize);
-   glUnmapBuffer(GL_UNIFORM_BUFFER);
+// Weighted blended OIT (McGuire & Bavoil 2013). One pass sums weighted
+// colors and multiplies up how much shows through, the second divides it
+// out. No sorting and fixed memory, but only an approximation where
+// layers overlap.
+void BrainStemGL::paintWeighted()
+{
+   const GLenum bufs[] = {GL_COLOR_ATTACHMENT0+WB_ACCUM, GL_COLOR_ATTACHMENT0+WB_REVEAL};
+   const GLfloat none[] = {0.0, 0.0, 0.0, 0.0};
+   const GLfloat all[] = {1.0, 1.0, 1.0, 1.0};
+   GLenum err_chk;
 
-     // update transform for normals
-   glBindBufferBase(GL_UNIFORM_BUFFER,nUboBlkId,nUboBuff);
-   void* mv_ptr = glMapBufferRange(GL_UNIFORM_BUFFER,0,mvSize,
-                             GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT);
-   memcpy(mv_ptr,&mvMat,mvSize);
-   glUnmapBuffer(GL_UNIFORM_BUFFER);
+   glDrawBuffers(2,bufs);
+   glClearBufferfv(GL_COLOR,0,none);
+   glClearBufferfv(GL_COLOR,1,all);
+   glEnable(GL_BLEND);
+   glBlendFunci(0,GL_ONE,GL_ONE);
+   glBlendFunci(1,GL_ZERO,GL_ONE_MINUS_SRC_COLOR);
+   oitPass(WEIGHTED_PASS);
+   paintTranslucent();
    err_chk = glGetError();
    if (err_chk != 0)
-       cout << "paint error 1 is: " << err_chk << endl;
+      cout << "weighted error is: " << err_chk << endl;
 
-    // Do first render pass
-    // Init vars to create fragment/pixel lists by the shaders for OIT sorting later
+   glBindFramebuffer(GL_FRAMEBUFFER,defaultFramebufferObject());
    glDisable(GL_DEPTH_TEST);
-   glDisable(GL_CULL_FACE);
+   glBlendFunc(GL_ONE, GL_ONE_MINUS_SRC_ALPHA);    // compose is premultiplied
+   compose(0,oitTex[WB_ACCUM],oitTex[WB_REVEAL]);
+   glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA); 
    glDisable(GL_BLEND);
+}
 
-     // Reset atomic counter
-    glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
-    glBindBufferBase(GL_ATOMIC_COUNTER_BUFFER, 0, atomicCounterBuff);
-    texdata = (GLuint *)glMapBuffer(GL_ATOMIC_COUNTER_BUFFER, GL_WRITE_ONLY);
-#if 0
-// for debugging, the oit shader will return some info
-    texdata = (GLuint *)glMapBuffer(GL_ATOMIC_COUNTER_BUFFER, GL_READ_WRITE);
-    cout << "nodes: " << texdata[0] << "  max: " << MAX_OIT_NODES << "  " << double(texdata[0])/MAX_OIT_NODES << "%" << " OIT buffer in use" << endl;
-#endif
-    texdata[0] = 0;
-    glUnmapBuffer(GL_ATOMIC_COUNTER_BUFFER);
-#if 0
-// more debugging
-    glBindBufferBase(GL_SHADER_STORAGE_BUFFER,nodeId,nodeCount);
-    GLuint* ptr = (GLuint*) glMapBuffer(GL_SHADER_STORAGE_BUFFER,GL_READ_WRITE);
-    if (ptr)
-    {
-       cout << "max nodes: in use " << ptr[0] << endl;
-       ptr[0] = 0;
-       glUnmapBuffer(GL_SHADER_STORAGE_BUFFER);
-    }
-#endif
-       // Re-init head-pointer image
-   glBindBuffer(GL_PIXEL_UNPACK_BUFFER, headPointerInitVal);
-   glActiveTexture(GL_TEXTURE0);
-   glBindTexture(GL_TEXTURE_2D, headPointerTex);
-   glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, MAX_FB_WIDTH,MAX_FB_HEIGHT, GL_RED_INTEGER, GL_UNSIGNED_INT, nullptr);
-
-   if (showOutlines)
-   {
-      glEnable(GL_PRIMITIVE_RESTART); // <- pre 4.5 opengl used this for non-indexed
-      glUseProgram(outlineProg);      // draws, which it should not because it clobbers 
-      glBindVertexArray(outlinesVao); // at least one structure object, so leave it off 
-                                      // until we use it, then turn it back off.
-      glBindBuffer(GL_ELEMENT_ARRAY_BUFFER,outlinesIdx); //  until we need it
-      glDrawElements(GL_LINE_LOOP,outlinesIdxSize,GL_UNSIGNED_INT,nullptr);
-      glDisable(GL_PRIMITIVE_RESTART);
-   }
+// Dual depth peeling (Bavoil & Myers 2008). Every pass peels off the
+// nearest and the farthest layer left at each pixel. Fronts are blended
+// under the fronts so far, backs over the backs so far. A pass is only
+// drawn if the one before it found back layers, the gpu decides that
+// without the cpu waiting on it. Stops after PEEL_PASSES.
+void BrainStemGL::paintPeeled()
+{
+   const GLenum depthBuf = GL_COLOR_ATTACHMENT0+PEEL_DEPTH;
+   const GLenum frontBuf = GL_COLOR_ATTACHMENT0+PEEL_FRONT;
+   const GLenum blendBuf = GL_COLOR_ATTACHMENT0+PEEL_BLEND;
+   const GLfloat empty[] = {-1.0, -1.0, 0.0, 0.0};   // max blended
+   const GLfloat none[] = {0.0, 0.0, 0.0, 0.0};
+   GLuint samples, avail;
+   GLenum err_chk;
+   int prev = 0, next, pass;
 
-   if (showAxes)
+     // If the last pass of a frame before still found back layers, there
+     // may have been more than it could peel. Looked at when it's ready.
+   if (peelQueried && !peelCapShown)
    {
-      glUseProgram(axesProg);
-      glBindVertexArray(axesVao);
-      glDrawArrays(GL_LINES,0,axesSize);
+      glGetQueryObjectuiv(peelQuery[PEEL_PASSES-1],GL_QUERY_RESULT_AVAILABLE,&avail);
+      if (avail)
+      {
+         glGetQueryObjectuiv(peelQuery[PEEL_PASSES-1],GL_QUERY_RESULT,&samples);
+         if (samples)
+         {
+            QString msg;
+            QTextStream(&msg) << "Depth peeling stops at " << 2*PEEL_PASSES
+                              << " layers, the middle ones of deeper pixels are left out.";
+            emit(chatBox(msg));
+            peelCapShown = true;
+         }
+      }
    }
 
-   if (twinkleOn || spinOn || printClear)  // print info
+   glDrawBuffers(1,&frontBuf);
+   glClearBufferfv(GL_COLOR,0,none);
+   glDrawBuffers(1,&blendBuf);
+   glClearBufferfv(GL_COLOR,0,none);
+
+     // nearest and farthest of everything
+   glDrawBuffers(1,&depthBuf);
+   glClearBufferfv(GL_COLOR,0,empty);
+   glEnable(GL_BLEND);
+   glBlendEquation(GL_MAX);
+   oitPass(PEEL_INIT_PASS);
+   paintTranslucent();
+
+   oitPass(PEEL_PASS);
+   for (pass = 0; pass < PEEL_PASSES; ++pass)
    {
-      glUseProgram(printProg);
-      glBindVertexArray(printVao);
+        // A pass that added nothing means every layer is peeled, the ones
+        // after it are skipped. The fronts aren't ping-ponged so skipping
+        // leaves them whole.
+      if (pass > 0)
+         glBeginConditionalRender(peelQuery[pass-1],GL_QUERY_WAIT);
+      next = 1 - prev;
+      const GLenum bufs[] = {GL_COLOR_ATTACHMENT0+PEEL_DEPTH+next,
+                             GL_COLOR_ATTACHMENT0+PEEL_FRONT,
+                             GL_COLOR_ATTACHMENT0+PEEL_BACK+next};
+      glDrawBuffers(3,bufs);
+      glClearBufferfv(GL_COLOR,0,empty);
+      glClearBufferfv(GL_COLOR,2,none);
+      glActiveTexture(GL_TEXTURE1);
+      glBindTexture(GL_TEXTURE_2D,oitTex[PEEL_DEPTH+prev]);
       glActiveTexture(GL_TEXTURE0);
-      glBindTexture(GL_TEXTURE_2D,printText);
-      glDrawArrays(GL_TRIANGLES,0,sizeText);
-      glBindTexture(GL_TEXTURE_2D,0);
-      printClear = false;
+      glEnable(GL_DEPTH_TEST);
+      glBlendEquation(GL_MAX);
+      glBlendEquationi(1,GL_FUNC_ADD);
+      glBlendFunci(1,GL_ONE_MINUS_DST_ALPHA,GL_ONE);
+      paintTranslucent();
+
+        // this pass's back layer over the ones before it
+      glDrawBuffers(1,&blendBuf);
+      glDisable(GL_DEPTH_TEST);
+      glBlendEquation(GL_FUNC_ADD);
+      glBlendFuncSeparate(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA, GL_ONE, GL_ONE_MINUS_SRC_ALPHA);
+      glBeginQuery(GL_SAMPLES_PASSED,peelQuery[pass]);
+      compose(1,oitTex[PEEL_BACK+next],0);
+      glEndQuery(GL_SAMPLES_PASSED);
+      if (pass > 0)
+         glEndConditionalRender();
+      prev = next;
    }
+   peelQueried = true;
+   err_chk = glGetError();
+   if (err_chk != 0)
+      cout << "peel error is: " << err_chk << endl;
+
+     // fronts over backs, over the opaque pass
+   glBindFramebuffer(GL_FRAMEBUFFER,defaultFramebufferObject());
+   glDisable(GL_DEPTH_TEST);
+   glBlendEquation(GL_FUNC_ADD);
+   glBlendFunc(GL_ONE, GL_ONE_MINUS_SRC_ALPHA);    // compose is premultiplied
+   compose(2,oitTex[PEEL_FRONT],oitTex[PEEL_BLEND]);
+   glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA); 
+   glDisable(GL_BLEND);
+}
 
-   if (skinOn)
+// Draw the window quad with the compose shader, textures in units 1 & 2
+void BrainStemGL::compose(GLint mode, GLuint first, GLuint second)
+{
+   glActiveTexture(GL_TEXTURE1);
+   glBindTexture(GL_TEXTURE_2D,first);
+   glActiveTexture(GL_TEXTURE2);
+   glBindTexture(GL_TEXTURE_2D,second);
+   glActiveTexture(GL_TEXTURE0);
+   glUseProgram(composeProgs[stereoView]);
+   glUniform1i(0,mode);
+   glBindVertexArray(showVao);
+   glDrawArraysInstanced(GL_TRIANGLE_STRIP,0,4,viewInstances);
+}
+
+// Tell the translucent shaders what pass this is
+void BrainStemGL::oitPass(GLint pass)
+{
+   glProgramUniform1i(printProg,20,pass);
+   for (int view = 0; view < VIEWS; ++view)
    {
-      glUseProgram(sort_skinProg); // create/add to transparency list
-      glBindVertexArray(skinVao);
-      glDrawArrays(GL_TRIANGLES,0,skinSize);
+      glProgramUniform1i(sort_skinProgs[view],20,pass);
+      if (structProgs[view])
+         glProgramUniform1i(structProgs[view],20,pass);
    }
+   for (GLuint prog : cellPrograms())
+      glProgramUniform1i(prog,20,pass);
+}
 
-   if (structsFirst.size() > 0)
-   {
-      glUseProgram(structProg);    // create/add to transparency list
-      glBindVertexArray(structVao);
+// Draw the skin, either opaque or into the translucent layer
+void BrainStemGL::paintSkin(bool opaque)
+{
+   glUseProgram(sort_skinProgs[stereoView]);
+   glUniform1i(8,opaque);
+   glBindVertexArray(skinVao);
+   glDrawArraysInstanced(GL_TRIANGLES,0,skinSize,viewInstances);
+}
+
+// Same for the brain structures
+void BrainStemGL::paintStructs(bool opaque)
+{
+   glUseProgram(structProgs[stereoView]);
+   glUniform1i(5,opaque);
+   glBindVertexArray(structVao);
+   if (viewInstances == 1)
       glMultiDrawArrays(GL_TRIANGLES, structsFirst.data(), structsCount.data(),structsFirst.size()); 
-   }
-   
-   if (cellsVao.size())
+   else   // no instanced multi draw without a command buffer
+      for (size_t idx = 0; idx < structsFirst.size(); ++idx)
+         glDrawArraysInstanced(GL_TRIANGLES,structsFirst[idx],structsCount[idx],viewInstances);
+}
+
+// Draw the cells for the current stereo mode, either opaque with depth
+// testing or into the transparency lists.
+void BrainStemGL::paintCells(bool opaque)
+{
+   int idx;
+
+   if (cellRows.size())
    {
-      vaoCellListIter iter;
-      glUseProgram(cellProg);
-      void* stereo_ptr;
-      GLuint mode;
+      cellRowListIter iter;
+      GLuint *progs = useImpostors ? cellImpProgs : cellProgs;
+      bool pair = stereoMode == CTRL_STIM_PAIR || stereoMode == CTRLSIB_PAIR || stereoMode == STIMSIB_PAIR;
+      bool test_depth = !opaque && (oitEngine == OIT_LISTS || oitEngine == OIT_KBUFFER);
+
+        // the pairs draw each half with its own view
+      for (int view : {pair ? MONO_VIEW : stereoView, pair ? RIGHT_VIEW : stereoView})
+      {
+         glProgramUniform1f(progs[view],6,currCycle ? cyclePhase : -1.0);  // < 0 is base color
+         glProgramUniform1i(progs[view],8,opaque);
+         glProgramUniform1i(progs[view],15,!opaque && deferCells);
+         if (useImpostors)
+         {
+            glProgramUniformMatrix4fv(progs[view],16,1,GL_FALSE,glm::value_ptr(projMat));
+            glProgramUniform1i(progs[view],17,test_depth);
+         }
+      }
+      glUseProgram(progs[stereoView]);
+      if (useImpostors)
+      {
+         if (test_depth)   // the peelers draw into the fbo it is part of
+         {
+            glActiveTexture(GL_TEXTURE3);
+            glBindTexture(GL_TEXTURE_2D,oitDepthTex);
+            glActiveTexture(GL_TEXTURE0);
+         }
+      }
+      glBindVertexArray(lodDrawVbo ? cellLodVao : cellVao);
+      glVertexAttribDivisor(2,cellCopies());   // a row for each eye's instance
+      if (lodDrawVbo)   // culled, lists not drawn are empty
+      {
+         glBindBuffer(GL_DRAW_INDIRECT_BUFFER,lodDrawVbo);
+         if (!pair)
+         {
+            glMultiDrawArraysIndirect(useImpostors ? GL_POINTS : GL_TRIANGLES,nullptr,lodListCount*SPHERE_LODS,0);
+            return;
+         }
+      }
 
-      for (idx = 0, iter = cellsVao.begin(); iter != cellsVao.end(); ++idx,++iter)
+      for (idx = 0, iter = cellRows.begin(); iter != cellRows.end(); ++idx,++iter)
       {
          if (onOff[idx])
          {
-            glBindVertexArray(iter->second[currCycle].vao);
             switch (stereoMode)
             {
                 // for this case, draw 1st coord/color list in 1st viewport, 
                 // then switch mode and draw again using 2nd coord/color 
                 // list in 2nd viewport
                case CTRL_STIM_PAIR:
-                  if (iter->second[currCycle].cellSize[CONTROL_PTS])
+                  if (iter->second.cellSize[CONTROL_PTS])
                   {
-                     mode=CTRL_PART;
-                     glBindBufferBase(GL_UNIFORM_BUFFER,sUboBlkId,sUboBuff);
-                     stereo_ptr = glMapBufferRange(GL_UNIFORM_BUFFER,0,sizeof(mode),
-                                   GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT);
-                     memcpy(stereo_ptr,&mode,sizeof(mode));
-                     glUnmapBuffer(GL_UNIFORM_BUFFER);
-                     glDrawArraysInstanced(GL_TRIANGLES,0,sphereSize, iter->second[currCycle].cellSize[CONTROL_PTS]);
+                     glUseProgram(progs[MONO_VIEW]);
+                     drawCells(iter->second,CONTROL_PTS);
                   }
 
-                  if (iter->second[currCycle].cellSize[STIM_PTS])
+                  if (iter->second.cellSize[STIM_PTS])
                   {
-                     mode=STIM_PART;
-                     glBindBufferBase(GL_UNIFORM_BUFFER,sUboBlkId,sUboBuff);
-                     stereo_ptr = glMapBufferRange(GL_UNIFORM_BUFFER,0,sizeof(mode),
-                                   GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT);
-                     memcpy(stereo_ptr,&mode,sizeof(mode));
-                     glUnmapBuffer(GL_UNIFORM_BUFFER);
-
-                     glDrawArraysInstanced(GL_TRIANGLES,0,sphereSize, iter->second[currCycle].cellSize[STIM_PTS]);
+                     glUseProgram(progs[RIGHT_VIEW]);
+                     drawCells(iter->second,STIM_PTS);
                   }
-                  glBindBufferBase(GL_UNIFORM_BUFFER,sUboBlkId,sUboBuff);
-                  stereo_ptr = glMapBufferRange(GL_UNIFORM_BUFFER,0,sizeof(stereoMode),
-                                            GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT);
-                  memcpy(stereo_ptr,&stereoMode,sizeof(stereoMode));
-                  glUnmapBuffer(GL_UNIFORM_BUFFER);
                   break;
 
                case CTRLSIB_PAIR:
-                  if (iter->second[currCycle].cellSize[CONTROL_PTS])
+                  if (iter->second.cellSize[CONTROL_PTS])
                   {
-                     mode=CTRL_PART;
-                     glBindBufferBase(GL_UNIFORM_BUFFER,sUboBlkId,sUboBuff);
-                     stereo_ptr = glMapBufferRange(GL_UNIFORM_BUFFER,0,sizeof(mode),
-                                   GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT);
-                     memcpy(stereo_ptr,&mode,sizeof(mode));
-                     glUnmapBuffer(GL_UNIFORM_BUFFER);
-                     glDrawArraysInstanced(GL_TRIANGLES,0,sphereSize, iter->second[currCycle].cellSize[CONTROL_PTS]);
+                     glUseProgram(progs[MONO_VIEW]);
+                     drawCells(iter->second,CONTROL_PTS);
                   }
 
-                  if (iter->second[currCycle].cellSize[CTRLSIB_PTS])
+                  if (iter->second.cellSize[CTRLSIB_PTS])
                   {
-                     mode=CTRLSIB_PART;
-                     glBindBufferBase(GL_UNIFORM_BUFFER,sUboBlkId,sUboBuff);
-                     stereo_ptr = glMapBufferRange(GL_UNIFORM_BUFFER,0,sizeof(mode),
-                                   GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT);
-                     memcpy(stereo_ptr,&mode,sizeof(mode));
-                     glUnmapBuffer(GL_UNIFORM_BUFFER);
-
-                     glDrawArraysInstanced(GL_TRIANGLES,0,sphereSize, iter->second[currCycle].cellSize[CTRLSIB_PTS]);
+                     glUseProgram(progs[RIGHT_VIEW]);
+                     drawCells(iter->second,CTRLSIB_PTS);
                   }
-                  glBindBufferBase(GL_UNIFORM_BUFFER,sUboBlkId,sUboBuff);
-                  stereo_ptr = glMapBufferRange(GL_UNIFORM_BUFFER,0,sizeof(stereoMode),
-                                            GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT);
-                  memcpy(stereo_ptr,&stereoMode,sizeof(stereoMode));
-                  glUnmapBuffer(GL_UNIFORM_BUFFER);
                   break;
 
                case STIMSIB_PAIR:
-                  if (iter->second[currCycle].cellSize[STIMSIB_PTS])
+                  if (iter->second.cellSize[STIMSIB_PTS])
                   {
-                     mode=STIMSIB_PART;
-                     glBindBufferBase(GL_UNIFORM_BUFFER,sUboBlkId,sUboBuff);
-                     stereo_ptr = glMapBufferRange(GL_UNIFORM_BUFFER,0,sizeof(mode),
-                                   GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT);
-                     memcpy(stereo_ptr,&mode,sizeof(mode));
-                     glUnmapBuffer(GL_UNIFORM_BUFFER);
-                     glDrawArraysInstanced(GL_TRIANGLES,0,sphereSize, iter->second[currCycle].cellSize[STIMSIB_PTS]);
+                     glUseProgram(progs[MONO_VIEW]);
+                     drawCells(iter->second,STIMSIB_PTS);
                   }
 
-                  if (iter->second[currCycle].cellSize[STIM_PTS])
+                  if (iter->second.cellSize[STIM_PTS])
                   {
-                     mode=STIM_PART;
-                     glBindBufferBase(GL_UNIFORM_BUFFER,sUboBlkId,sUboBuff);
-                     stereo_ptr = glMapBufferRange(GL_UNIFORM_BUFFER,0,sizeof(mode),
-                                   GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT);
-                     memcpy(stereo_ptr,&mode,sizeof(mode));
-                     glUnmapBuffer(GL_UNIFORM_BUFFER);
-
-                     glDrawArraysInstanced(GL_TRIANGLES,0,sphereSize, iter->second[currCycle].cellSize[STIM_PTS]);
+                     glUseProgram(progs[RIGHT_VIEW]);
+                     drawCells(iter->second,STIM_PTS);
                   }
-                  glBindBufferBase(GL_UNIFORM_BUFFER,sUboBlkId,sUboBuff);
-                  stereo_ptr = glMapBufferRange(GL_UNIFORM_BUFFER,0,sizeof(stereoMode),
-                                            GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT);
-                  memcpy(stereo_ptr,&stereoMode,sizeof(stereoMode));
-                  glUnmapBuffer(GL_UNIFORM_BUFFER);
                   break;
 
                case CONTROL_ONLY:
                case CONTROL_STEREO:
-                  if (iter->second[currCycle].cellSize[CONTROL_PTS])
-                     glDrawArraysInstanced(GL_TRIANGLES,0,sphereSize, iter->second[currCycle].cellSize[CONTROL_PTS]);
+                  drawCells(iter->second,CONTROL_PTS);
                   break;
 
                case STIM_ONLY:
                case STIM_STEREO:
-                  if (iter->second[currCycle].cellSize[STIM_PTS])
-                     glDrawArraysInstanced(GL_TRIANGLES,0,sphereSize, iter->second[currCycle].cellSize[STIM_PTS]);
+                  drawCells(iter->second,STIM_PTS);
                   break;
 
                case DELTA_ONLY:
                case DELTA_STEREO:
-                  if (iter->second[currCycle].cellSize[DELTA_PTS])
-                     glDrawArraysInstanced(GL_TRIANGLES,0,sphereSize, iter->second[currCycle].cellSize[DELTA_PTS]);
+                  drawCells(iter->second,DELTA_PTS);
                   break;
 
                case CTRLSIB_ONLY:
                case CTRLSIB_STEREO:
-                  if (iter->second[currCycle].cellSize[CTRLSIB_PTS])
-                     glDrawArraysInstanced(GL_TRIANGLES,0,sphereSize, iter->second[currCycle].cellSize[CTRLSIB_PTS]);
+                  drawCells(iter->second,CTRLSIB_PTS);
                   break;
 
                case STIMSIB_ONLY:
                case STIMSIB_STEREO:
-                  if (iter->second[currCycle].cellSize[STIMSIB_PTS])
-                     glDrawArraysInstanced(GL_TRIANGLES,0,sphereSize, iter->second[currCycle].cellSize[STIMSIB_PTS]);
+                  drawCells(iter->second,STIMSIB_PTS);
                   break;
             }
          }
       }
    }
-   err_chk = glGetError();
-   if (err_chk != 0)
-      cout << "paint error 2 is: " << err_chk << endl;
-
-       // second pass, sort the lists and render
-   glFlush();                                      // tell the above to complete
-   glMemoryBarrier(GL_SHADER_STORAGE_BARRIER_BIT); // then wait for it
-   glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT );
-   glUseProgram(finalRenderProg);
-   glBindVertexArray(showVao);
-   glDrawArrays(GL_TRIANGLE_STRIP,0,4);
-
-   err_chk = glGetError();
-   if (err_chk != 0)
-      cout << "paint error 3 is: " << err_chk << endl;
-
-   glBindBuffer(GL_ELEMENT_ARRAY_BUFFER,0); // nothing in scope
-   glBindVertexArray(0);
-   glUseProgram(0);
-   glBindTexture(GL_TEXTURE_2D,0);
-   glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
-
-//clock_gettime(CLOCK_MONOTONIC,&frameEnd);
-//interval = (frameEnd.tv_sec*1000*1000*1000 + frameEnd.tv_nsec) - (frameStart.tv_sec*1000*1000*1000 + frameStart.tv_nsec);
-//cout << "Repaint time: " << (unsigned long)(interval/(1000.0 * 1000.0)) << endl;
 }
 
 // new window size or exposure
@@ -2000,6 +3262,11 @@ void BrainStemGL::resizeGL(int width, int height)
       bottom = -top;
    }
 
+   oitPool(width,height);
+   oitHeads(width,height);
+   oitTargets(width,height);
+   listsStale = true;
+   staticStale = true;
    viewPortW = width/2.0;  // for stereo view
    viewPortH = height;
    viewMat = glm::translate(glm::mat4(1.0f),glm::vec3(0, 0, -zd)); // default
@@ -2047,7 +3314,7 @@ void BrainStemGL::spinAgain()
    angle += angleDir * step;
    if (angle >= 360.0 || angle <= -360.0)
       angle = 0.0;
-   update();
+   sceneUpdate();
 
    if (Debug && (!twinkleOn || numBins == 0))
    {
@@ -2067,7 +3334,7 @@ void BrainStemGL::rotateY()
    makeCurrent();
    resizeGL(geometry().width(),geometry().height());
    doneCurrent();
-   update();
+   sceneUpdate();
 }
 
 void BrainStemGL::rotateX()
@@ -2078,7 +3345,7 @@ void BrainStemGL::rotateX()
    makeCurrent();
    resizeGL(geometry().width(),geometry().height());
    doneCurrent();
-   update();
+   sceneUpdate();
 }
 
 void BrainStemGL::rotateZ()
@@ -2089,7 +3356,7 @@ void BrainStemGL::rotateZ()
    makeCurrent();
    resizeGL(geometry().width(),geometry().height());
    doneCurrent();
-   update();
+   sceneUpdate();
 }
 
 void BrainStemGL::updateRegions(BrainSel& sel)
@@ -2102,7 +3369,7 @@ void BrainStemGL::updateRegions(BrainSel& sel)
       structsFirst.push_back(selStructs[*iter].first);
       structsCount.push_back(selStructs[*iter].count);
    }
-   update();
+   sceneUpdate();
 }
 
 
@@ -2126,18 +3393,15 @@ void BrainStemGL::toggleStereo(STEREO_MODE mode)
          stereoViewports = 1;
          break;
    }
+   stereoView = stereoViewports == 2 ? STEREO_VIEW : MONO_VIEW;
+   viewInstances = vsViewports && stereoView == STEREO_VIEW ? 2 : 1;
    GLfloat box_aspect = (1.0-(1.0/((GLfloat)DRAWBOX_W/DRAWBOX_H)))/stereoViewports;
    drawBox[1] = drawBox[4] = drawBox[16] = box_aspect;
 
    makeCurrent();
-   glBindBufferBase(GL_UNIFORM_BUFFER,sUboBlkId,sUboBuff);
-   void* stereo_ptr = glMapBufferRange(GL_UNIFORM_BUFFER,0,sizeof(stereoMode),
-                             GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT);
-   memcpy(stereo_ptr,&stereoMode,sizeof(stereoMode));
-   glUnmapBuffer(GL_UNIFORM_BUFFER);
    resizeGL(geometry().width(),geometry().height());
    doneCurrent();
-   update();
+   sceneUpdate();
 }
 
 void BrainStemGL::showCtlStim(STEREO_MODE mode)
@@ -2168,30 +3432,29 @@ void BrainStemGL::reset()
    makeCurrent();  // done for us on callbacks, but need to do it explicitly here
    resizeGL(geometry().width(),geometry().height());
    doneCurrent();
-   update();    // request a repaint
+   sceneUpdate();    // request a repaint
 }
 
 void BrainStemGL::doForeGround(int value)
 {
    outlineColorVal[0] = outlineColorVal[1] = outlineColorVal[2] = value / 255.0;
-   makeCurrent();
-   glUseProgram(outlineProg);
-   glUniform4fv(outlineColor,1,glm::value_ptr(outlineColorVal));
-   glUseProgram(0);
-   doneCurrent();
-   update();
+   if (outlineProgs[MONO_VIEW])   // else outlines() sets it
+   {
+      makeCurrent();
+      for (GLuint prog : outlineProgs)
+         glProgramUniform4fv(prog,0,1,glm::value_ptr(outlineColorVal));
+      doneCurrent();
+   }
+   sceneUpdate();
 }
 
 void BrainStemGL::doBackGround(int value)
 {
    backColor = value/255.0;
-   if (finalRenderProg)
+   if (finalRenderProgs[MONO_VIEW])
    {
       makeCurrent();  // done for us on callbacks, but need to do it explicitly here
-      glClearColor(backColor,backColor,backColor,1.0);
-      glUseProgram(finalRenderProg);
-      glUniform4f(1,backColor,backColor,backColor,1.0);
-      glUseProgram(0);
+      glClearColor(backColor,backColor,backColor,0.0);
       doneCurrent();
       clearInfo();
    }
@@ -2209,13 +3472,13 @@ void BrainStemGL::doDelayChanged(int value)
 void BrainStemGL::doToggleAxes(bool onoff)
 {
    showAxes = onoff;
-   update();
+   sceneUpdate();
 }
 
 void BrainStemGL::doToggleOutlines(bool onoff)
 {
    showOutlines = onoff;
-   update();
+   sceneUpdate();
 }
 
 void BrainStemGL::spinToggle(bool onoff)
@@ -2237,25 +3500,52 @@ void BrainStemGL::doTwinkleChanged(int val)
    timerTwinkle = val;
 }
 
+// Where the phrenic line goes for a color cycle
+int BrainStemGL::phrenicPos(size_t cycle)
+{
+     // round off error at boundry preventers:
+   if (cycle == 1)
+      return PHRENIC_I_START;
+   else if (cycle == numBins/2+1)
+      return PHRENIC_E_START;
+   else if (cycle == numBins)
+      return PHRENIC_E_END;
+   else
+      return PHRENIC_I_START + cycle*phrenicStep;
+}
+
 // do next step in color cycling, with wrap-around
-void BrainStemGL::twinkleAgain()
+// Step is in bins, a fraction of one blends to the next bin's colors.
+void BrainStemGL::twinkleAgain(double step)
 {
    QString update;
    QTextStream updateInfo(&update);
+   size_t last_cycle = currCycle;
+   int last_pos = phrenicLinePos;
+   double frac;
 
    if (numBins)
    {
-      if (++currCycle > numBins) // for next time
-         currCycle = 1;  // skip 1st color, its the default color
-        // round off error at boundry preventers:
-      if (currCycle == 1)
-         phrenicLinePos = PHRENIC_I_START;
-      else if (currCycle == numBins/2+1)
-         phrenicLinePos = PHRENIC_E_START;
-      else if (currCycle == numBins)
-         phrenicLinePos = PHRENIC_E_END;
+      if (currCycle == 0)     // skip 1st color, its the default color
+         cyclePhase = 0.0;
+      else if (step >= 1.0)   // whole steps land on a bin
+         cyclePhase = floor(cyclePhase) + step;
       else
-         phrenicLinePos = PHRENIC_I_START + currCycle*phrenicStep;
+         cyclePhase += step;
+      cyclePhase = fmod(cyclePhase,numBins);
+      currCycle = size_t(cyclePhase) + 1;
+
+      phrenicLinePos = phrenicPos(currCycle);
+      frac = cyclePhase - floor(cyclePhase);
+      if (frac > 0.0 && currCycle < numBins)
+         phrenicLinePos += frac * (phrenicPos(currCycle+1) - phrenicLinePos);
+
+        // between bins, only redo the info box if the line moved
+      if (currCycle == last_cycle && phrenicLinePos == last_pos)
+      {
+         colorUpdate();
+         return;
+      }
 
       if (Debug && recordingMovie)
          updateInfo << qSetFieldWidth(3) << "fps: " << movieFPS;
@@ -2268,6 +3558,29 @@ void BrainStemGL::twinkleAgain()
    }
 }
 
+// Anything but the cell colors changing means the lists have to be built
+// again, so everything in here that asks for a repaint comes through here.
+// Unless it says otherwise, the skin and structures changed too.
+void BrainStemGL::sceneUpdate()
+{
+   listsStale = true;
+   staticStale = true;
+   QOpenGLWidget::update();
+}
+
+// Only the cells or the info box changed, see staticLayer()
+void BrainStemGL::cellsUpdate()
+{
+   listsStale = true;
+   QOpenGLWidget::update();
+}
+
+// Only the cell colors or the info box changed, see recolorLists()
+void BrainStemGL::colorUpdate()
+{
+   QOpenGLWidget::update();
+}
+
 // On transition to/from single shade color mode,
 // load the appropriate color table to the fragment shader
 void BrainStemGL::singleTwinkle(bool val)
@@ -2276,7 +3589,7 @@ void BrainStemGL::singleTwinkle(bool val)
    makeCurrent();
    updateCellProg();
    doneCurrent();
-   update();
+   cellsUpdate();
 }
 
 void BrainStemGL::singleStep(bool val)
@@ -2285,86 +3598,51 @@ void BrainStemGL::singleStep(bool val)
    if (singleMode)
    {
       twinkleOn = true;
-      update();
+      cellsUpdate();
    }
 }
 
 void BrainStemGL::doHideCells(bool onoff)
 {
    hideCells = onoff;
-   if (cellProg)
-   {
-      makeCurrent();
-      glUseProgram(cellProg);
-      glUniform1i(5,onoff);
-      glUseProgram(0);
-      doneCurrent();
-      update();
-   }
+   lightStale = FRAME_SLOTS;
+   cellsUpdate();
 }
 
 void BrainStemGL::doPtSizeChanged(int size)
 {
    ptSize = abs(size);
-   if (cellProg)
-   {
 // cout << "sphere size: " << ptSize << endl;
-      makeCurrent();
-      glUseProgram(cellProg);
-      glUniform1i(4,ptSize);
-      glUseProgram(0);
-      doneCurrent();
-      update();
-   }
+   lightStale = FRAME_SLOTS;
+   cellsUpdate();
 }
 
 void BrainStemGL::doSkinToggle(bool state)
 {
    skinOn = state;
-   update();
+   sceneUpdate();
 }
 
 
 void BrainStemGL::doSkinTransparencyChanged(int trans)
 {
    skinTrans = trans / 100.0;
-   if (sort_skinProg)
-   {
-      makeCurrent();
-      glUseProgram(sort_skinProg);
-      glUniform1f(1,skinTrans);
-      glUseProgram(0);
-      doneCurrent();
-      update();
-   }
+   lightStale = FRAME_SLOTS;
+   sceneUpdate();
 }
 
 void BrainStemGL::doCellTransparencyChanged(int trans)
 {
    cellTrans = trans / 100.0;
-   if (sort_skinProg)
-   {
-      makeCurrent();
-      glUseProgram(cellProg);
-      glUniform1f(14,cellTrans);
-      glUseProgram(0);
-      doneCurrent();
-      update();
-   }
+   lightStale = FRAME_SLOTS;
+   cellsUpdate();
 }
 
 void BrainStemGL::doRegionTransChanged(int trans)
 {
    regionTrans = trans / 100.0;
-   if (structProg)
-   {
-      makeCurrent();
-      glUseProgram(structProg);
-      glUniform1f(1,regionTrans);
-      glUseProgram(0);
-      doneCurrent();
-      update();
-   }
+   lightStale = FRAME_SLOTS;
+   sceneUpdate();
 }
 
 
@@ -2393,7 +3671,7 @@ int BrainStemGL::movieFrame()
    file.open(QIODevice::WriteOnly);
 
    makeCurrent();
-   QImage  aFrame = grabFramebuffer();
+   QImage  aFrame = grabComplete();
    aFrame.save(&file, "PNG");
    doneCurrent();
    return currFrame;
@@ -2466,7 +3744,7 @@ bool BrainStemGL::movieStop()
 void BrainStemGL::saveFrame(QString& pngName, QString& pdfName)
 {
    makeCurrent();
-   QImage aFrame = grabFramebuffer();
+   QImage aFrame = grabComplete();
 
    if (pngName.length())
    {
@@ -2495,140 +3773,54 @@ void BrainStemGL::saveFrame(QString& pngName, QString& pdfName)
 void BrainStemGL::doAmbient(int val)
 {
    ambient = val;
-
-   if (sort_skinProg)
-   {
-      makeCurrent();
-      glm::vec3 amb(ambient/100.0,ambient/100.0,ambient/100.0);
-      glUseProgram(sort_skinProg);
-      glUniform3fv(2,1,glm::value_ptr(amb));
-
-      glUseProgram(cellProg);
-      glUniform3fv(11,1,glm::value_ptr(amb));
-
-      glUseProgram(structProg);
-      glUniform3fv(2,1,glm::value_ptr(amb));
-
-      glUseProgram(0);
-      doneCurrent();
-      update();
-   }
+   lightStale = FRAME_SLOTS;
+   sceneUpdate();
 }
 
 void BrainStemGL::doDiffuse(int val)
 {
    diffuse = val;
-
-   if (sort_skinProg)
-   {
-      makeCurrent();
-      glm::vec3 dif(diffuse/100.0,diffuse/100.0,diffuse/100.0);
-      glUseProgram(sort_skinProg);
-      glUniform3fv(3,1,glm::value_ptr(dif));
-
-      glUseProgram(cellProg);
-      glUniform3fv(12,1,glm::value_ptr(dif));
-
-      glUseProgram(structProg);
-      glUniform3fv(3,1,glm::value_ptr(dif));
-
-      glUseProgram(0);
-      doneCurrent();
-      update();
-   }
+   lightStale = FRAME_SLOTS;
+   sceneUpdate();
 }
 
 void BrainStemGL::doLightDistX(int val)
 {
    dX = val/10.0;
-   if (sort_skinProg)
-   {
-      glm::vec3 dist(dX,dY,dZ);
-
-      makeCurrent();
-      glUseProgram(sort_skinProg);
-      glUniform3fv(4,1,glm::value_ptr(dist));
-
-      glUseProgram(cellProg);
-      glUniform3fv(13,1,glm::value_ptr(dist));
-
-      glUseProgram(structProg);
-      glUniform3fv(4,1,glm::value_ptr(dist));
-
-      glUseProgram(0);
-      doneCurrent();
-      update();
-   }
+   lightStale = FRAME_SLOTS;
+   sceneUpdate();
 }
 
 void BrainStemGL::doLightDistY(int val)
 {
    dY = val/10.0;
-   if (sort_skinProg)
-   {
-      glm::vec3 dist(dX,dY,dZ);
-
-      makeCurrent();
-      glUseProgram(sort_skinProg);
-      glUniform3fv(4,1,glm::value_ptr(dist));
-
-      glUseProgram(cellProg);
-      glUniform3fv(13,1,glm::value_ptr(dist));
-
-      glUseProgram(structProg);
-      glUniform3fv(4,1,glm::value_ptr(dist));
-
-      glUseProgram(0);
-      doneCurrent();
-      update();
-   }
+   lightStale = FRAME_SLOTS;
+   sceneUpdate();
 }
 
 
 void BrainStemGL::doLightDistZ(int val)
 {
    dZ = val / 10.0;
-
-   if (sort_skinProg)
-   {
-      glm::vec3 dist(dX,dY,dZ);
-      makeCurrent();
-      glUseProgram(sort_skinProg);
-      glUniform3fv(4,1,glm::value_ptr(dist)); // see glsl code for uniform magic nums
-
-      glUseProgram(cellProg);
-      glUniform3fv(13,1,glm::value_ptr(dist));
-
-      glUseProgram(structProg);
-      glUniform3fv(4,1,glm::value_ptr(dist));
-
-      glUseProgram(0);
-      doneCurrent();
-      update();
-   }
+   lightStale = FRAME_SLOTS;
+   sceneUpdate();
 }
 
 
 // tan color
 void BrainStemGL::doSurfaceT()
 {
-   makeCurrent();
-   glUseProgram(sort_skinProg);
-   glUniform1i(5,0);
-   glUseProgram(0);
-   doneCurrent();
-   update();
+   surfaceSel = 0;
+   lightStale = FRAME_SLOTS;
+   sceneUpdate();
 }
 
 // white color
 void BrainStemGL::doSurfaceW()
 {
-   makeCurrent();
-   glUseProgram(sort_skinProg);
-   glUniform1i(5,1);
-   glUseProgram(0);
-   doneCurrent();
-   update();
+   surfaceSel = 1;
+   lightStale = FRAME_SLOTS;
+   sceneUpdate();
 }
 
 
@@ -2638,7 +3830,7 @@ void BrainStemGL::doOrtho()
    makeCurrent();  // done for us on callbacks, but need to do it explicitly here
    resizeGL(geometry().width(),geometry().height());
    doneCurrent();
-   update();
+   sceneUpdate();
 }
 
 
@@ -2648,7 +3840,7 @@ void BrainStemGL::doPerspec()
    makeCurrent();  // done for us on callbacks, but need to do it explicitly here
    resizeGL(geometry().width(),geometry().height());
    doneCurrent();
-   update();
+   sceneUpdate();
 }
 
 void BrainStemGL::doFov(int value)
@@ -2657,7 +3849,7 @@ void BrainStemGL::doFov(int value)
    makeCurrent();
    resizeGL(geometry().width(),geometry().height());
    doneCurrent();
-   update();
+   sceneUpdate();
 }
 
 // if you add stuff, update version
@@ -35,82 +35,49 @@ This file is part of the USF Brainstem Data Visualization suite.
    syn keyword glslStorageClass uimage2D uimageBuffer
 */
 
-/* These are from the STEREO_MODE enum in brainstem.h
-   stereo = 0  control only
-   stereo = 1  control stereo 
-   stereo = 2  ctl and stim pair 
-   stereo = 3  ctl part of pair (draw on 1st pass)
-   stereo = 4  stim part of pair (draw on 2nd pass)
-   stereo = 5  stim only
-   stereo = 6  stim stereo 
-   stereo = 7  delta only
-   stereo = 8  delta stereo
-   stereo = 9  ctrlsib pair 
-   stereo = 10 ctrlsib only 
-   stereo = 11 ctrlsib stereo
-   stereo = 12 ctrl sib part of ctrlsib pair (draw on 2nd pass, right viewport)
-   stereo = 13 stimsib pair
-   stereo = 14 stimsib only
-   stereo = 15 stimsib stereo
-   stereo = 16 simsib part of ctrlsib pair (draw on 1st viewport, left viewport)
+/* The shaders that pick the viewport(s) are built once per view, see
+   viewHead() in brainstemgl.cpp, which puts these in front of them:
+   EYES     invocations, 2 draws both viewports in one pass
+   EYE      the viewport and transforms an invocation uses, 0 is the left
+            (or only) one, 1 the right, gl_InvocationID for both
+   VS_VIEWS the vertex shader picks the viewport itself and there is no
+            geometry shader. Both views are drawn as 2 instances, EYE is
+            the instance's low bit.
+   Shaders with no view, and the vertex shaders ahead of a geometry shader,
+   just get the #version.
 */
 
 // V shader for oulines and axes
 const char* vertexVSrc =
 R"(
-#version 430
 in vec3 vp;
+#ifdef VS_VIEWS
+layout (std140,binding=1) uniform vertexUbo{ mat4 mvp[2];};
+void main() {
+  gl_ViewportIndex = EYE;
+  gl_Position = mvp[EYE] * vec4(vp,1.0);
+}
+#else
 void main() {
   gl_Position = vec4(vp,1.0);
 }
+#endif
 )";
 
 const char* vertexGSrc =
 R"(
-#version 430
-#define CONTROL_ONLY     0
-#define CONTROL_STEREO   1
-#define CTL_STIM_PAIR    2
-#define CTL_PART         3
-#define STIM_PART        4
-#define STIM_ONLY        5
-#define STIM_STEREO      6
-#define DELTA_ONLY       7
-#define DELTA_STEREO     8
-#define CTRLSIB_PAIR     9
-#define CTRLSIB_ONLY    10
-#define CTRLSIB_STEREO  11
-#define CTRLSIB_PART    12
-#define STIMSIB_PAIR    13
-#define STIMSIB_ONLY    14
-#define STIMSIB_STEREO  15
-#define STIMSIB_PART    16
-layout (lines) in;
-layout (invocations = 2) in;
+layout (lines, invocations = EYES) in;
 layout (line_strip, max_vertices=2) out;
 layout (std140,binding=1) uniform vertexUbo{ mat4 mvp[2];};
-layout (binding=4) uniform useStereo{int stereo;};
 void main() {
    int i;
-   bool is_stereo;
-   if (stereo==CONTROL_STEREO || stereo==CTL_STIM_PAIR || 
-       stereo==STIM_STEREO || stereo==DELTA_STEREO || 
-       stereo==CTRLSIB_PAIR || stereo==STIMSIB_PAIR ||
-       stereo==CTRLSIB_STEREO || stereo==STIMSIB_STEREO)
-      is_stereo = true;
-   else
-     is_stereo=false;
-        // draw nothing on 2nd invocation if in non-stereo mode
-   if (is_stereo || ((!is_stereo) && gl_InvocationID == 0))
+   for (i = 0; i < gl_in.length(); i++)
    {
-      for (i = 0; i < gl_in.length(); i++)
-      {
-         gl_ViewportIndex = gl_InvocationID;
-         gl_Position = mvp[gl_InvocationID] * gl_in[i].gl_Position;
-         EmitVertex();
-      }
-      EndPrimitive();
+      gl_ViewportIndex = EYE;
+      gl_Position = mvp[EYE] * gl_in[i].gl_Position;
+      EmitVertex();
    }
+   EndPrimitive();
 }
 )";
 
@@ -119,33 +86,10 @@ void main() {
 const char* outlineFSrc =
 R"(
 #version 430
-struct OITNode {
-   vec4 color;
-   float depth;
-   uint next;
-   };
-layout (early_fragment_tests) in;
-layout (binding = 0,r32ui) uniform uimage2D head_pointer;
-layout (binding = 0, offset = 0) uniform atomic_uint list_counter;
-layout (binding = 0,std430) buffer list_buffer { OITNode nodes[]; };
-layout (std140,binding=2) uniform nodesUbo{ uint max_nodes;};
-
-uniform vec4 outlineColor;
+layout (location = 0) uniform vec4 outlineColor;
 out vec4 fcolor;
 void main() {
-
    fcolor  = outlineColor;
-   if (fcolor.a > 0)
-   {
-      uint index = atomicCounterIncrement(list_counter);
-      if (index < max_nodes)
-      {
-         uint old_head = imageAtomicExchange(head_pointer, ivec2(gl_FragCoord.xy),index);
-         nodes[index].color=fcolor;
-         nodes[index].depth=gl_FragCoord.z;
-         nodes[index].next=old_head;
-      }
-   }
 }
 )";
 
@@ -153,307 +97,508 @@ void main() {
 const char* axesFSrc =
 R"(
 #version 430
-struct OITNode {
-   vec4 color;
-   float depth;
-   uint next;
-   };
-layout (early_fragment_tests) in;
-layout (binding = 0,r32ui) uniform uimage2D head_pointer;
-layout (binding = 0, offset = 0) uniform atomic_uint list_counter;
-layout (binding = 0,std430) buffer list_buffer { OITNode nodes[]; };
-layout (std140,binding=2) uniform nodesUbo{ uint max_nodes;};
-uniform uint MaxNodes;
-uniform vec4 axesColor; 
+layout (location = 0) uniform vec4 axesColor;
 out vec4 fcolor;
 void main() {
    fcolor = axesColor;
-   if (fcolor.a > 0)
+}
+)";
+
+
+// The cell's color comes from its normalized CTH at the current phase,
+// blended between adjacent bins, then mapped to one of its shades.
+// Compiled ahead of the cell vertex shader, and of the compute resolve,
+// which colors cells the lists hold as rows, after the #version and
+// whatever else the caller puts first.
+const char* cellShadeSrc =
+R"(
+#define COLOR_STEPS     16       // same as in brainstemgl.cpp
+#define D_COLOR_STEPS    8
+layout (location = 6) uniform float phase = -1.0;  // bin.fraction, < 0 is base color
+layout (location = 7) uniform int num_bins = 0;
+struct CellRow
+{
+   vec3 pos;
+   int offset;      // start of the cell's shades, < 0 for delta
+};
+layout (std430,binding=4) buffer cellTable {CellRow cells[];};
+layout (std430,binding=5) buffer cthTable {float cth[];};   // num_bins per cell
+layout (std140,binding=3) buffer deltaColorTable {vec4 dtab[];};
+layout (std140,binding=2) buffer colorTable {vec4 ctab[];};
+
+vec4 cellColor(int row)
+{
+   int idx;
+   int offset = cells[row].offset;
+   if (phase < 0.0 || num_bins == 0)
+      return offset < 0 ? dtab[D_COLOR_STEPS-1] : ctab[offset];
+   int bin = int(phase);
+   int first = row * num_bins;
+   float val = mix(cth[first+bin],cth[first+(bin+1)%num_bins],phase-bin);
+   if (offset < 0)
    {
-      uint index = atomicCounterIncrement(list_counter);
-      if (index < max_nodes)
-      {
-         uint old_head = imageAtomicExchange(head_pointer, ivec2(gl_FragCoord.xy),index);
-         nodes[index].color=fcolor;
-         nodes[index].depth=gl_FragCoord.z;
-         nodes[index].next=old_head;
-      }
+      if (val >= 0.0)
+         idx = int(floor(D_COLOR_STEPS - val*D_COLOR_STEPS));
+      else
+         idx = int(ceil((D_COLOR_STEPS+1) - val*D_COLOR_STEPS));
+      return dtab[idx];
    }
+   idx = min(int(floor((COLOR_STEPS-1) - val*(COLOR_STEPS-1))),COLOR_STEPS-1);
+   return ctab[offset+idx];
 }
 )";
 
+// Lighting, materials, and the cell point size, one block the cell, skin,
+// and structure shaders share, compiled ahead of those that use it. Each
+// frame's ring slot has a copy, see frameLights(). Same layout as lightBlock.
+const char* lightSrc =
+R"(
+layout (std140,binding=4) uniform lightUbo
+{
+   vec3 ambient;
+   float skin_trans;
+   vec3 light_color;
+   float cell_trans;
+   vec3 light_dir;
+   float region_trans;
+   int scale;            // the sphere mesh is divided by it
+   bool hide_off;        // cells that are off in this bin aren't drawn
+   int surface_sel;      // skin color, 0 is tan, 1 white
+};
+)";
 
 // using instance drawing.  We draw a sphere, which has this called many times
-// but the cell_pos and other vars advance to the next location once per sphere.
+// but cell_row advances to the next cell once per sphere.  Draws start at
+// their list's first row using the base instance, or at the rows the cull
+// pass gathered for their level. With VS_VIEWS and both eyes, each cell is
+// two instances in a row, the rows' divisor is 2. Compiled after cellShadeSrc
+// and lightSrc.
 const char* cellVSrc =
 R"(
-#version 430
 layout (location = 0) in vec3 vp;           // sphere vertices
 layout (location = 1) in vec3 norm;         // sphere normals
-layout (location = 2) in vec3 cell_pos0;    // control, once per instance for location
-layout (location = 3) in vec3 cell_pos1;    // stim 
-layout (location = 4) in vec3 cell_pos2;    // delta 
-layout (location = 5) in int colorsel0;     // control
-layout (location = 6) in int colorsel1;     // stim
-layout (location = 7) in int colorsel2;     // delta
-layout (location = 8) in int colorsel3;     // ctrlsib
-layout (location = 9) in int colorsel4;     // stimsib
-layout (location = 10)in vec3 cell_pos3;    // ctrlsib
-layout (location = 11)in vec3 cell_pos4;    // stimsib
-layout (location = 4) uniform int scale=90;
-out flat int ctl_cidx;
-out flat int stim_cidx;
-out flat int delta_cidx;
-out flat int ctrlsib_cidx;
-out flat int stimsib_cidx;
-out flat vec4 ctl_pos;
-out flat vec4 stim_pos;
-out flat vec4 delta_pos;
-out flat vec4 ctrlsib_pos;
-out flat vec4 stimsib_pos;
+layout (location = 2) in int cell_row;      // once per instance
+#ifdef VS_VIEWS
+layout (std140,binding=1) uniform vertexUbo {mat4 mvp[2];};
+layout (binding = 3, std140) uniform normUbo {mat4 mv[2];};
+out vec4 c_color;
+out flat int c_row;
+out vec3 c_norm;
+
+void main() {
+   c_color = cellColor(cell_row);
+   c_row   = cell_row;
+   c_norm  = normalize(mat3(mv[EYE])*norm);
+   gl_ViewportIndex = EYE;
+   if (hide_off && c_color.rgb == vec3(0.0))
+      gl_Position = vec4(2.0,2.0,2.0,1.0);   // outside the view, clipped
+   else
+      gl_Position = mvp[EYE] * vec4((vp/scale + cells[cell_row].pos),1.0);
+}
+#else
+out vec4 cell_pos;
+out flat vec4 cell_color;
+out flat int row_id;
 out vec3 colornorm;
+
 void main() {
-   ctl_pos     = vec4((vp/scale + cell_pos0),1.0);
-   stim_pos    = vec4((vp/scale + cell_pos1),1.0);
-   delta_pos   = vec4((vp/scale + cell_pos2),1.0);
-   ctrlsib_pos = vec4((vp/scale + cell_pos3),1.0);
-   stimsib_pos = vec4((vp/scale + cell_pos4),1.0);
-   ctl_cidx   = colorsel0;
-   stim_cidx  = colorsel1;
-   delta_cidx = colorsel2;
-   ctrlsib_cidx = colorsel3;
-   stimsib_cidx = colorsel4;
+   cell_pos   = vec4((vp/scale + cells[cell_row].pos),1.0);
+   cell_color = cellColor(cell_row);
+   row_id     = cell_row;
    colornorm  = norm;
 }
+#endif
 )";
 
 
+// Cull pass ahead of drawing cells, one invocation per cell. Compiled
+// after cellShadeSrc and the sizes from sphere(). Each list of cells has a
+// draw per level, SPHERE_LODS in a row, and the lists are in the order of
+// their rows. A list that isn't drawn has no triangles. A cell that is in
+// view, and not hidden for being off in this bin, goes in its list's draw
+// for the level its size on screen needs. Impostors only use the first.
+// An icosahedron is round to within a quarter pixel up to LOD_PIXELS of
+// radius, each level after it holds for 4 times that.
+const char* cellCullCSrc =
+R"(
+#define LOD_PIXELS 1.5
+layout (local_size_x = LOD_GROUP) in;
+struct DrawCommand
+{
+   uint count;
+   uint instances;
+   uint first;
+   uint base_instance;
+};
+layout (std140,binding=1) uniform vertexUbo {mat4 mvp[2];};
+layout (binding = 3, std140) uniform normUbo {mat4 mv[2];};
+layout (std430,binding=1) writeonly buffer lodRows {int lod_rows[];};
+layout (std430,binding=7) buffer lodDraws {DrawCommand draws[];};
+layout (location = 0) uniform uint num_cells;
+layout (location = 1) uniform int num_lists;
+layout (location = 2) uniform float radius;       // scaled by the point size
+layout (location = 3) uniform float focal;        // pixels per unit, at 1 unit away in perspective
+layout (location = 4) uniform bool perspective;
+layout (location = 5) uniform bool hide_off = false;
+layout (location = 8) uniform int eyes = 1;       // viewports
+layout (location = 9) uniform int lods = SPHERE_LODS;
+layout (location = 10) uniform uint copies = 1u;  // instances per cell
+
+// Is the sphere inside all six planes of a view's frustum
+bool inView(mat4 m, vec4 pos)
+{
+   mat4 rows = transpose(m);
+   vec4 plane;
+   int axis;
+
+   for (axis = 0; axis < 3; axis++)
+   {
+      plane = rows[3] + rows[axis];
+      if (dot(plane,pos) < -radius * length(plane.xyz))
+         return false;
+      plane = rows[3] - rows[axis];
+      if (dot(plane,pos) < -radius * length(plane.xyz))
+         return false;
+   }
+   return true;
+}
+
+void main()
+{
+   uint row = gl_GlobalInvocationID.x;
+   int lo = 0;
+   int hi = num_lists - 1;
+   int mid, lod, draw;
+   float size;
+   vec4 pos;
+
+   if (row >= num_cells)
+      return;
+     // the last list starting at or before this row
+   while (lo < hi)
+   {
+      mid = (lo + hi + 1) / 2;
+      if (draws[mid*SPHERE_LODS].base_instance <= row)
+         lo = mid;
+      else
+         hi = mid - 1;
+   }
+   if (draws[lo*SPHERE_LODS].count == 0)
+      return;
+   pos = vec4(cells[row].pos,1.0);
+   if (!inView(mvp[0],pos) && (eyes == 1 || !inView(mvp[1],pos)))
+      return;
+   if (hide_off && cellColor(int(row)).rgb == vec3(0.0))
+      return;
+   size = radius * focal;
+   if (perspective)
+      size /= max(-(mv[0] * pos).z,radius);
+   lod = clamp(int(floor(log2(max(size,0.01) / LOD_PIXELS) / 2.0)) + 1,0,lods-1);
+   draw = lo * SPHERE_LODS + lod;
+   lod_rows[draws[draw].base_instance + atomicAdd(draws[draw].instances,copies) / copies] = int(row);
+}
+)";
+
+// Ahead of both cell geometry shaders, after lightSrc. The caller draws the list that goes
+// with the mode with the program built for its viewport(s), so this just
+// drops hidden cells.
+const char* cellViewSrc =
+R"(
+layout (std140,binding=1) uniform vertexUbo {mat4 mvp[2];};
+layout (binding = 3, std140) uniform normUbo {mat4 mv[2];}; //  uniform
+
+// Does this cell get drawn
+bool drawCell(vec4 color)
+{
+   return !(hide_off && color.rgb == vec3(0.0));
+}
+)";
+
 // geometry shader for cells  
 // input from vert, outputs to frag
 const char* cellGSrc =
 R"(
-#version 430
-#define CONTROL_ONLY     0
-#define CONTROL_STEREO   1
-#define CTL_STIM_PAIR    2
-#define CTL_PART         3
-#define STIM_PART        4
-#define STIM_ONLY        5
-#define STIM_STEREO      6
-#define DELTA_ONLY       7
-#define DELTA_STEREO     8
-#define CTRLSIB_PAIR     9
-#define CTRLSIB_ONLY    10
-#define CTRLSIB_STEREO  11
-#define CTRLSIB_PART    12
-#define STIMSIB_PAIR    13
-#define STIMSIB_ONLY    14
-#define STIMSIB_STEREO  15
-#define STIMSIB_PART    16
-layout(triangles, invocations=2) in;
+layout(triangles, invocations=EYES) in;
 layout(triangle_strip,max_vertices=3) out;
-layout (location=5) uniform bool hideOff = false;
-layout (std140,binding=3) buffer deltaColorTable {vec4 dtab[];}; // buffer
-layout (std140,binding=2) buffer colorTable {vec4 ctab[];};
-layout (std140,binding=1) uniform vertexUbo {mat4 mvp[2];};
-layout (binding = 3, std140) uniform normUbo {mat4 mv[2];}; //  uniform
-layout (binding=4) uniform useStereo {int stereo;};
-in flat int ctl_cidx[];
-in flat int stim_cidx[];
-in flat int delta_cidx[];
-in flat int ctrlsib_cidx[];
-in flat int stimsib_cidx[];
-in flat vec4 ctl_pos[];
-in flat vec4 stim_pos[];
-in flat vec4 delta_pos[];
-in flat vec4 ctrlsib_pos[];
-in flat vec4 stimsib_pos[];
+in vec4 cell_pos[];
+in flat vec4 cell_color[];
+in flat int row_id[];
 in vec3 colornorm[];
 out vec4 c_color;
+out flat int c_row;
 out vec3 c_norm;
 void main() {
-   int gcidx;
-   bool drawpt = true;
    int i;
-   bool is_stereo;
-   bool ctlstim=false;
-   bool second_list=false;
-   if (stereo==CONTROL_STEREO || stereo==CTL_STIM_PAIR || 
-       stereo==STIM_STEREO || stereo==DELTA_STEREO || 
-       stereo==CTRLSIB_PAIR || stereo==STIMSIB_PAIR || 
-       stereo==CTRLSIB_STEREO || stereo==STIMSIB_STEREO)
-      is_stereo=true;
-   else
-      is_stereo=false;
 
-      // draw ctl pts & colors in this mode
-   if (stereo==CTL_PART || stereo==STIM_PART || stereo == CTRLSIB_PART || stereo == STIMSIB_PART)
-   {
-      if (stereo==CTL_PART && gl_InvocationID==0) // ctl pts on 1st pass
-      {
-         for (i = 0; i < gl_in.length(); i++)
-         {
-            gl_Position = mvp[gl_InvocationID] * ctl_pos[i];
-            gl_ViewportIndex = gl_InvocationID;
-            c_norm = normalize(mat3(mv[gl_InvocationID])*colornorm[i]);
-            gcidx = ctl_cidx[i];
-            c_color = ctab[gcidx];
-            if (hideOff == true && drawpt == true) // once false always false
-            {
-               if ((c_color[0] == 0.0) && (c_color[1] == 0.0) && (c_color[2] == 0.0))
-                  drawpt = false;
-            }
-            if (drawpt == true)
-            {
-               EmitVertex();
-            }
-         }
-         EndPrimitive();
-      }
-      else if (stereo==STIM_PART && gl_InvocationID==1) // stim pts/colors
-      {
-         for (i = 0; i < gl_in.length(); i++)
-         {
-            gl_Position = mvp[gl_InvocationID] * stim_pos[i];
-            gl_ViewportIndex = gl_InvocationID;
-            c_norm = normalize(mat3(mv[gl_InvocationID])*colornorm[i]);
-            gcidx = stim_cidx[i];
-            c_color = ctab[gcidx];
-            if (hideOff == true && drawpt == true) // once false always false
-            {
-               if ((c_color[0] == 0.0) && (c_color[1] == 0.0) && (c_color[2] == 0.0))
-                  drawpt = false;
-            }
-            if (drawpt == true)
-            {
-               EmitVertex();
-            }
-         }
-         EndPrimitive();
-      }
-      else if (stereo==CTRLSIB_PART && gl_InvocationID==1) // ctl sib pts 
-      {
-         for (i = 0; i < gl_in.length(); i++)
-         {
-            gl_Position = mvp[gl_InvocationID] * ctrlsib_pos[i];
-            gl_ViewportIndex = gl_InvocationID;
-            c_norm = normalize(mat3(mv[gl_InvocationID])*colornorm[i]);
-            gcidx = ctrlsib_cidx[i];
-            c_color = ctab[gcidx];
-            if (hideOff == true && drawpt == true) // once false always false
-            {
-               if ((c_color[0] == 0.0) && (c_color[1] == 0.0) && (c_color[2] == 0.0))
-                  drawpt = false;
-            }
-            if (drawpt == true)
-            {
-               EmitVertex();
-            }
-         }
-         EndPrimitive();
-      }
-      else if (stereo==STIMSIB_PART && gl_InvocationID==0) // stimsib pts/colors
-      {
-         for (i = 0; i < gl_in.length(); i++)
-         {
-            gl_Position = mvp[gl_InvocationID] * stimsib_pos[i];
-            gl_ViewportIndex = gl_InvocationID;
-            c_norm = normalize(mat3(mv[gl_InvocationID])*colornorm[i]);
-            gcidx = stimsib_cidx[i];
-            c_color = ctab[gcidx];
-            if (hideOff == true && drawpt == true) // once false always false
-            {
-               if ((c_color[0] == 0.0) && (c_color[1] == 0.0) && (c_color[2] == 0.0))
-                  drawpt = false;
-            }
-            if (drawpt == true)
-            {
-               EmitVertex();
-            }
-         }
-         EndPrimitive();
-      }
-   }
-   else if (is_stereo || ((!is_stereo) && gl_InvocationID == 0))
+   if (drawCell(cell_color[0]))
    {
       for (i = 0; i < gl_in.length(); i++)
       {
-         if (stereo==CONTROL_ONLY || stereo == CONTROL_STEREO)
-         {
-            gl_Position = mvp[gl_InvocationID] * ctl_pos[i];
-            gcidx = ctl_cidx[i];
-            c_color = ctab[gcidx];
-         }
-         else if (stereo==STIM_ONLY || stereo==STIM_STEREO)
-         {
-            gl_Position = mvp[gl_InvocationID] * stim_pos[i];
-            gcidx = stim_cidx[i];
-            c_color = ctab[gcidx];
-         }
-         else if (stereo==DELTA_ONLY || stereo==DELTA_STEREO)
-         {
-            gl_Position = mvp[gl_InvocationID] * delta_pos[i];
-            gcidx = delta_cidx[i];
-            c_color = dtab[gcidx];
-         }
-         else if (stereo==CTRLSIB_ONLY || stereo==CTRLSIB_STEREO)
-         {
-            gl_Position = mvp[gl_InvocationID] * ctrlsib_pos[i];
-            gcidx = ctrlsib_cidx[i];
-            c_color = ctab[gcidx];
-         }
-         else if (stereo==STIMSIB_ONLY || stereo==STIMSIB_STEREO)
-         {
-            gl_Position = mvp[gl_InvocationID] * stimsib_pos[i];
-            gcidx = stimsib_cidx[i];
-            c_color = ctab[gcidx];
-         }
-         gl_ViewportIndex = gl_InvocationID;
-         c_norm = normalize(mat3(mv[gl_InvocationID])*colornorm[i]);
-         if (hideOff == true && drawpt == true) // once false always false
-         {
-            if ((c_color[0] == 0.0) && (c_color[1] == 0.0) && (c_color[2] == 0.0))
-               drawpt = false;
-         }
-         if (drawpt == true)
-         {
-            EmitVertex();
-         }
+         gl_Position = mvp[EYE] * cell_pos[i];
+         gl_ViewportIndex = EYE;
+         c_norm = normalize(mat3(mv[EYE])*colornorm[i]);
+         c_color = cell_color[i];
+         c_row = row_id[i];
+         EmitVertex();
       }
       EndPrimitive();
    }
 }
 )";
 
-// shader for cell colors
-const char* cellFSrc =
+// Impostor cells, one point per cell instead of a sphere mesh. The
+// geometry shader makes a square that covers the sphere, the fragment
+// shader casts a ray at it. Compiled after cellShadeSrc.
+const char* cellImpVSrc =
+R"(
+layout (location = 2) in int cell_row;      // once per instance
+out vec4 cell_pos;
+out flat vec4 cell_color;
+out flat int row_id;
+
+void main() {
+   cell_pos   = vec4(cells[cell_row].pos,1.0);
+   cell_color = cellColor(cell_row);
+   row_id     = cell_row;
+}
+)";
+
+// Compiled after cellViewSrc. The square is in eye space, facing down the
+// ray to the cell's center, big enough for the sphere's outline from there.
+// Ortho looks straight down z. SPHERE_RADIUS goes in front with the view.
+const char* cellImpGSrc =
+R"(
+layout(points, invocations=EYES) in;
+layout(triangle_strip,max_vertices=4) out;
+layout (location = 16) uniform mat4 proj;
+in vec4 cell_pos[];
+in flat vec4 cell_color[];
+in flat int row_id[];
+out vec4 c_color;
+out flat int c_row;
+out vec3 c_eye;              // point on the square
+out flat vec3 c_center;
+out flat float c_radius;
+void main() {
+   vec3 center = vec3(mv[EYE] * cell_pos[0]);
+   float radius = SPHERE_RADIUS / scale;
+   float half_size = radius;
+   vec3 right = vec3(1.0,0.0,0.0);
+   vec3 up = vec3(0.0,1.0,0.0);
+   vec3 eye;
+   int i;
+
+   if (!drawCell(cell_color[0]))
+      return;
+   if (proj[2][3] != 0.0)   // perspective
+   {
+      float dist = length(center);
+      if (dist <= radius)   // inside it
+         return;
+      vec3 view = center / dist;
+      right = normalize(cross(view,abs(view.y) < 0.99 ? up : right));
+      up = cross(right,view);
+      half_size = radius * dist / sqrt(dist * dist - radius * radius);
+   }
+   for (i = 0; i < 4; i++)
+   {
+      eye = center + (right * ((i & 1) == 0 ? -1.0 : 1.0) + up * ((i & 2) == 0 ? -1.0 : 1.0)) * half_size;
+      gl_Position = proj * vec4(eye,1.0);
+      gl_ViewportIndex = EYE;
+      c_eye = eye;
+      c_center = center;
+      c_radius = radius;
+      c_color = cell_color[0];
+      c_row = row_id[0];
+      EmitVertex();
+   }
+   EndPrimitive();
+}
+)";
+
+// Compiled ahead of the fragment shaders for things that can be see through
+// (cells, text, skin, structures). They call opaqueOut() when drawn in the
+// opaque pass and transOut() to hand a fragment to the transparency engine
+// running this pass, see the OIT_PASS enum in brainstemgl.h. Impostors
+// work out their own depth and set frag_depth, the others are compiled
+// with oitEarlySrc too.
+const char* oitFragSrc =
 R"(
 #version 430
+#define LIST_PASS       0
+#define WEIGHTED_PASS   1
+#define PEEL_INIT_PASS  2
+#define PEEL_PASS       3
+#define OVER_PASS       4
 struct OITNode {
-   vec4 color;
+   uint color;     // packed rgba8
    float depth;
    uint next;
    };
-layout (early_fragment_tests) in;
 layout (binding = 0,r32ui) uniform uimage2D head_pointer;
 layout (binding = 0,std430) buffer list_buffer { OITNode nodes[]; };
 layout (binding = 0, offset = 0) uniform atomic_uint list_counter;
-layout (location = 11) uniform vec3 ambient = vec3(0.0,0.0,0.0);
-layout (location = 12) uniform vec3 light_color = vec3(1.0,1.0,1.0);
-layout (location = 13) uniform vec3 light_dir = vec3(0.0,0.0,1.0);
-layout (location = 14) uniform float trans = 0.5;
 layout (std140,binding=2) uniform nodesUbo{ uint max_nodes;};
-in vec4 c_color;
+layout (binding = 1) uniform sampler2D peel_depth;  // -nearest,farthest left
+layout (location = 20) uniform int oit_pass = LIST_PASS;
+layout (location = 0) out vec4 frag_out0;  // color, weighted sum, or peel depths
+layout (location = 1) out vec4 frag_out1;  // weighted revealage, or peel front
+layout (location = 2) out vec4 frag_out2;  // peel back
+float frag_depth = -1.0;                   // < 0 is gl_FragCoord.z
+
+float fragDepth()
+{
+   return frag_depth < 0.0 ? gl_FragCoord.z : frag_depth;
+}
+
+void opaqueOut(vec4 color)
+{
+   frag_out0 = color;
+}
+
+// Add a node to this pixel's list. A deferred node's color is something
+// the resolve colors, it is flagged with the sign bit of its depth.
+void listOut(uint color, bool deferred)
+{
+   uint depth = floatBitsToUint(fragDepth());
+   uint index = atomicCounterIncrement(list_counter);
+
+   if (index < max_nodes)
+   {
+      uint old_head = imageAtomicExchange(head_pointer, ivec2(gl_FragCoord.xy),index);
+      nodes[index].color=color;
+      nodes[index].depth=uintBitsToFloat(deferred ? depth | 0x80000000u : depth);
+      nodes[index].next=old_head;
+   }
+}
+
+void transOut(vec4 color)
+{
+   float depth = fragDepth();
+
+   if (color.a <= 0)
+      discard;
+   if (oit_pass == LIST_PASS)
+      listOut(packUnorm4x8(color),false);
+   else if (oit_pass == OVER_PASS)   // straight over what is there
+      frag_out0 = color;
+   else if (oit_pass == WEIGHTED_PASS)
+   {
+        // weight falls off with distance so near layers win
+      float weight = color.a * clamp(3e3 * pow(1.0 - depth,3.0),1e-2,3e3);
+      frag_out0 = vec4(color.rgb * color.a,color.a) * weight;
+      frag_out1 = vec4(color.a);
+   }
+   else if (oit_pass == PEEL_INIT_PASS)   // blended with max
+      frag_out0 = vec4(-depth,depth,0,0);
+   else   // PEEL_PASS, blended with max so "nothing" is the smallest value
+   {
+      vec2 near_far = texelFetch(peel_depth,ivec2(gl_FragCoord.xy),0).xy;
+      float nearest = -near_far.x;
+      float farthest = near_far.y;
+      frag_out0 = vec4(-1.0);
+      frag_out1 = vec4(0.0);  // blended under the front layers so far
+      frag_out2 = vec4(0.0);
+      if (depth < nearest || depth > farthest)   // peeled already
+         return;
+      if (depth > nearest && depth < farthest)   // for a later pass
+      {
+         frag_out0 = vec4(-depth,depth,0,0);
+         return;
+      }
+      if (depth == nearest)   // premultiplied
+         frag_out1 = vec4(color.rgb * color.a,color.a);
+      else
+         frag_out2 = color;
+   }
+}
+)";
+
+// Hidden fragments never get to the lists, so the depth test goes first.
+// After oitFragSrc for everything but the impostors.
+const char* oitEarlySrc =
+R"(
+layout (early_fragment_tests) in;
+)";
+
+// The normal of the cell mesh, what cellFSrc lights
+const char* cellMeshFSrc =
+R"(
 in vec3 c_norm;
-out vec4 fcolor;
-void main() {
-   vec3 facenorm;
-   vec3 justcol=vec3(c_color);
 
+vec3 cellNormal()
+{
    if (gl_FrontFacing)
-      facenorm = c_norm;
+      return c_norm;
    else
-      facenorm = -c_norm;
+      return -c_norm;
+}
+
+bool cellBack(out vec3 norm)   // the far side is its own fragment
+{
+   norm = vec3(0.0);
+   return false;
+}
+)";
+
+// Or the impostor's, from where the ray through the pixel hits the sphere.
+// Its depth goes in the depth buffer and the lists. With no early depth
+// test, fragments behind the opaque pass are kept out of the lists here.
+// The mesh's far side shows through when it is see through, so the
+// impostor's far side is blended in under the near side.
+const char* cellImpFSrc =
+R"(
+layout (binding = 3) uniform sampler2D opaque_depth;
+layout (location = 16) uniform mat4 proj;
+layout (location = 17) uniform bool test_depth = false;
+in vec3 c_eye;
+in flat vec3 c_center;
+in flat float c_radius;
+vec3 back_norm;
+
+vec3 cellNormal()
+{
+   bool ortho = proj[2][3] == 0.0;
+   vec3 origin = ortho ? vec3(c_eye.xy,0.0) : vec3(0.0);
+   vec3 dir = ortho ? vec3(0.0,0.0,-1.0) : normalize(c_eye);
+   vec3 to_center = origin - c_center;
+   float b = dot(to_center,dir);
+   float disc = b * b - dot(to_center,to_center) + c_radius * c_radius;
+   vec3 hit;
+   vec4 clip;
+
+   if (disc < 0.0)
+      discard;
+   back_norm = (c_center - (origin - (b - sqrt(disc)) * dir)) / c_radius;
+   hit = origin - (b + sqrt(disc)) * dir;
+   clip = proj * vec4(hit,1.0);
+   frag_depth = (gl_DepthRange.diff * clip.z / clip.w + gl_DepthRange.near + gl_DepthRange.far) * 0.5;
+   gl_FragDepth = frag_depth;
+   if (test_depth && frag_depth >= texelFetch(opaque_depth,ivec2(gl_FragCoord.xy),0).r)
+      discard;
+   return (hit - c_center) / c_radius;
+}
+
+bool cellBack(out vec3 norm)
+{
+   norm = back_norm;
+   return true;
+}
+)";
+
+// shader for cell colors, compiled after oitFragSrc, lightSrc, and one of the above
+const char* cellFSrc =
+R"(
+layout (location = 8) uniform bool opaque = false;  // depth tested, not sorted
+layout (location = 15) uniform bool defer_color = false;  // lists get the row
+in vec4 c_color;
+in flat int c_row;
+void main() {
+   vec4 fcolor;
+   vec3 facenorm = cellNormal();
+   vec3 backnorm;
+   vec3 justcol=vec3(c_color);
+   float alpha = cell_trans;
 
    float diffuse = max(0.0,dot(facenorm,light_dir));
    vec3 scattered = ambient + light_color * diffuse;
@@ -476,18 +621,28 @@ vec3 reflected = light_color * specular;
 vec3 rgb = min(justcol * scattered + reflected, vec3(1.0));
 */
 
-   fcolor = vec4(rgb,trans);
-   if (fcolor.a > 0)
+   if (opaque)
    {
-      uint index = atomicCounterIncrement(list_counter);
-      if (index < max_nodes)
-      {
-         uint old_head = imageAtomicExchange(head_pointer, ivec2(gl_FragCoord.xy),index);
-         nodes[index].color=fcolor;
-         nodes[index].depth=gl_FragCoord.z;
-         nodes[index].next=old_head;
-      }
+      opaqueOut(vec4(rgb,1.0));
+      return;
+   }
+     // far side under the near one, the same light either side
+   if (cellBack(backnorm))
+   {
+      vec3 behind = ambient + light_color * max(0.0,dot(backnorm,light_dir));
+      scattered = (scattered + behind * (1.0 - cell_trans)) / (2.0 - cell_trans);
+      rgb = min(justcol*scattered,vec3(1.0));
+      alpha = cell_trans * (2.0 - cell_trans);
    }
+     // The resolve colors it for the current phase, see tileDeclSrc.
+     // Lights are gray, so one channel of the light is enough.
+   if (defer_color && oit_pass == LIST_PASS)
+   {
+      listOut(uint(c_row) | (uint(clamp(scattered.g * 0.5,0.0,1.0) * 255.0 + 0.5) << 24),true);
+      return;
+   }
+   fcolor = vec4(rgb,alpha);
+   transOut(fcolor);
 }
 )";
 
@@ -503,36 +658,15 @@ void main() {
 }
 )";
 
-// binding below is the n value in GL_TEXTUREn define
+// binding below is the n value in GL_TEXTUREn define, compiled after oitFragSrc
 const char* printFSrc =
 R"(
-#version 430
-struct OITNode {
-   vec4 color;
-   float depth;
-   uint next;
-   };
-layout (early_fragment_tests) in;
-layout (binding = 0,r32ui) uniform uimage2D head_pointer;
-layout (binding = 0, offset = 0) uniform atomic_uint list_counter;
-layout (binding = 0,std430) buffer list_buffer { OITNode nodes[]; };
 layout (binding=0) uniform sampler2D textstuff;
-layout (std140,binding=2) uniform nodesUbo{ uint max_nodes;};
 in vec2 tc;
-out vec4 tcolor;
 void main() {
+   vec4 tcolor;
    tcolor = texture(textstuff,tc);
-   if (tcolor.a > 0)
-   {
-      uint index = atomicCounterIncrement(list_counter);
-      if (index < max_nodes)
-      {
-         uint old_head = imageAtomicExchange(head_pointer, ivec2(gl_FragCoord.xy),index);
-         nodes[index].color=tcolor;
-         nodes[index].depth=gl_FragCoord.z;
-         nodes[index].next=old_head;
-      }
-   }
+   transOut(tcolor);
 }
 )";
 
@@ -540,100 +674,60 @@ void main() {
 // skin shaders
 const char* sort_skinVSrc =
 R"(
-#version 430
 layout (location=0) in vec3 vp;
 layout (location=1) in vec3 norm;
+#ifdef VS_VIEWS
+layout (std140,binding=1) uniform vertexUbo{ mat4 mvp[2];};
+layout (binding=3, std140) uniform normUbo {mat4 mv[2];};
+out vec3 c_norm;
+void main() {
+  gl_ViewportIndex = EYE;
+  gl_Position = mvp[EYE] * vec4(vp,1.0);
+  c_norm = normalize(mat3(mv[EYE])*norm);
+}
+#else
 out vec3 colornorm;
 void main() {
   gl_Position = vec4(vp,1.0);
   colornorm = norm;
 }
+#endif
 )";
 
 const char* sort_skinGSrc =
 R"(
-#version 430
-#define CONTROL_ONLY     0
-#define CONTROL_STEREO   1
-#define CTL_STIM_PAIR    2
-#define CTL_PART         3
-#define STIM_PART        4
-#define STIM_ONLY        5
-#define STIM_STEREO      6
-#define DELTA_ONLY       7
-#define DELTA_STEREO     8
-#define CTRLSIB_PAIR     9
-#define CTRLSIB_ONLY    10
-#define CTRLSIB_STEREO  11
-#define CTRLSIB_PART    12
-#define STIMSIB_PAIR    13
-#define STIMSIB_ONLY    14
-#define STIMSIB_STEREO  15
-#define STIMSIB_PART    16
-layout(triangles, invocations=2) in;
+layout(triangles, invocations=EYES) in;
 layout(triangle_strip,max_vertices=3) out;
 layout (std140,binding=1) uniform vertexUbo{ mat4 mvp[2];};
 layout (binding=3, std140) uniform normUbo {mat4 mv[2];};
-layout (binding=4) uniform useStereo{ int stereo;};
 in vec3 colornorm[];
 out vec3 c_norm;
 void main() {
    int i;
-   bool is_stereo;
-   if (stereo==CONTROL_STEREO || stereo==CTL_STIM_PAIR || 
-       stereo==STIM_STEREO || stereo==DELTA_STEREO ||
-       stereo==CTRLSIB_PAIR || stereo==STIMSIB_PAIR ||
-       stereo==CTRLSIB_STEREO || stereo==STIMSIB_STEREO)
-      is_stereo = true;
-   else
-      is_stereo=false;
-
-      // draw nothing on 2nd invocation if in non-stereo mode
-   if (is_stereo || ((!is_stereo) && gl_InvocationID == 0))
+   for (i = 0; i < gl_in.length(); i++)
    {
-      for (i = 0; i < gl_in.length(); i++)
-      {
-         c_norm = normalize(mat3(mv[gl_InvocationID])*colornorm[i]);
-         gl_Position = mvp[gl_InvocationID] * gl_in[i].gl_Position;
-         gl_ViewportIndex = gl_InvocationID;
-         EmitVertex();
-      }
-      EndPrimitive();
+      c_norm = normalize(mat3(mv[EYE])*colornorm[i]);
+      gl_Position = mvp[EYE] * gl_in[i].gl_Position;
+      gl_ViewportIndex = EYE;
+      EmitVertex();
    }
+   EndPrimitive();
 }
 )";
 
-
+// skin colors, compiled after oitFragSrc and lightSrc
 const char* sort_skinFSrc =
 R"(
-#version 430
-struct OITNode {
-   vec4 color;
-   float depth;
-   uint next;
-   };
-layout (early_fragment_tests) in;
-layout (binding = 0,r32ui) uniform uimage2D head_pointer;
-layout (binding = 0,std430) buffer list_buffer { OITNode nodes[]; };
-layout (binding = 0, offset = 0) uniform atomic_uint list_counter;
-layout (location = 1) uniform float trans = 0.7;
-layout (location = 2) uniform vec3 ambient = vec3(0.0,0.0,0.0);
-layout (location = 3) uniform vec3 light_color = vec3(1.0,1.0,1.0);
-layout (location = 4) uniform vec3 light_dir = vec3(0.0,0.0,0.5);
-layout (location = 5) uniform int surfaceSel = 0;
 layout (location = 6) uniform vec3 skinColorT = vec3(0.82,0.71,0.55);
 layout (location = 7) uniform vec3 skinColorW = vec3(0.81,0.81,0.81);
-layout (std140,binding=2) uniform nodesUbo{ uint max_nodes;};
+layout (location = 8) uniform bool opaque = false;  // depth tested, not sorted
 in vec3 c_norm;
-out vec4 fcolor;
 void main() {
+   vec4 fcolor;
    vec3 facenorm;
    vec3 currcolor;
-   uint index;
-   uint old_head;
-   uvec4 item;
 
-   if (surfaceSel == 0)
+   if (surface_sel == 0)
       currcolor = skinColorT;
    else
       currcolor = skinColorW;
@@ -646,112 +740,69 @@ void main() {
    float diffuse = max(0.0,dot(facenorm,light_dir));
    vec3 scattered = ambient + light_color * diffuse;
    vec3 rgb = min(currcolor * scattered,vec3(1.0));
-   fcolor = vec4(rgb,trans);
-   if (fcolor.a > 0)
+   if (opaque)
    {
-      index = atomicCounterIncrement(list_counter);
-      if (index < max_nodes)
-      {
-      old_head = imageAtomicExchange(head_pointer, ivec2(gl_FragCoord.xy),index);
-      nodes[index].color=fcolor;
-      nodes[index].depth=gl_FragCoord.z;
-      nodes[index].next=old_head;
-      }
+      opaqueOut(vec4(rgb,1.0));
+      return;
    }
+   fcolor = vec4(rgb,skin_trans);
+   transOut(fcolor);
 }
 )";
 
 // brain structure shaders
 const char* structVSrc =
 R"(
-#version 430
-layout (location = 0) in vec3 vp;
-layout (location = 1) in vec3 norm;
+layout (location=0) in vec3 vp;
+layout (location=1) in vec3 norm;
+#ifdef VS_VIEWS
+layout (std140,binding=1) uniform vertexUbo{ mat4 mvp[2];};
+layout (binding=3, std140) uniform normUbo {mat4 mv[2];};
+out vec3 c_norm;
+void main() {
+   gl_ViewportIndex = EYE;
+   gl_Position = mvp[EYE] * vec4(vp,1.0);
+   c_norm = normalize(mat3(mv[EYE])*norm);
+}
+#else
 out vec3 colornorm;
 void main() {
    gl_Position = vec4(vp,1.0);
    colornorm = norm;
 }
+#endif
 )";
 
 const char* structGSrc =
 R"(
-#version 430
-#define CONTROL_ONLY     0
-#define CONTROL_STEREO   1
-#define CTL_STIM_PAIR    2
-#define CTL_PART         3
-#define STIM_PART        4
-#define STIM_ONLY        5
-#define STIM_STEREO      6
-#define DELTA_ONLY       7
-#define DELTA_STEREO     8
-#define CTRLSIB_PAIR     9
-#define CTRLSIB_ONLY    10
-#define CTRLSIB_STEREO  11
-#define CTRLSIB_PART    12
-#define STIMSIB_PAIR    13
-#define STIMSIB_ONLY    14
-#define STIMSIB_STEREO  15
-#define STIMSIB_PART    16
-layout(triangles, invocations=2) in;
+layout(triangles, invocations=EYES) in;
 layout(triangle_strip,max_vertices=3) out;
 layout (std140,binding=1) uniform vertexUbo { mat4 mvp[2];};
 layout (binding=3, std140) uniform normUbo {mat4 mv[2];};
-layout (binding=4) uniform useStereo { int stereo;};
 in vec3 colornorm[];
 out vec3 c_norm;
 void main() {
    int i;
-   bool is_stereo;
-   if (stereo==CONTROL_STEREO || stereo==CTL_STIM_PAIR || 
-       stereo==STIM_STEREO || stereo==DELTA_STEREO ||
-       stereo==CTRLSIB_PAIR || stereo==STIMSIB_PAIR || 
-       stereo==CTRLSIB_STEREO || stereo==STIMSIB_STEREO)
-      is_stereo = true;
-   else
-      is_stereo=false;
-
-      // draw nothing on 2nd invocation if in non-stereo mode
-   if (is_stereo || ((!is_stereo) && gl_InvocationID == 0))
+   for (i = 0; i < gl_in.length(); i++)
    {
-      for (i = 0; i < gl_in.length(); i++)
-      {
-         c_norm = normalize(mat3(mv[gl_InvocationID])*colornorm[i]);
-         gl_Position = mvp[gl_InvocationID] * gl_in[i].gl_Position;
-         gl_ViewportIndex = gl_InvocationID;
-         EmitVertex();
-      }
-      EndPrimitive();
+      c_norm = normalize(mat3(mv[EYE])*colornorm[i]);
+      gl_Position = mvp[EYE] * gl_in[i].gl_Position;
+      gl_ViewportIndex = EYE;
+      EmitVertex();
    }
+   EndPrimitive();
 }
 )";
 
+// structure colors, compiled after oitFragSrc and lightSrc
 const char* structFSrc =
 R"(
-#version 430
-struct OITNode {
-   vec4 color;
-   float depth;
-   uint next;
-   };
-layout (early_fragment_tests) in;
-layout (binding = 0,r32ui) uniform uimage2D head_pointer;
-layout (binding = 0,std430) buffer list_buffer { OITNode nodes[]; };
-layout (binding = 0, offset = 0) uniform atomic_uint list_counter;
 layout (location = 0) uniform vec3 structColor = vec3(1.0,1.0,1.0);
-layout (location = 1) uniform float trans = 1.0;
-layout (location = 2) uniform vec3 ambient = vec3(0.0,0.0,0.0);
-layout (location = 3) uniform vec3 light_color = vec3(1.0,1.0,1.0);
-layout (location = 4) uniform vec3 light_dir = vec3(0.0,0.0,0.5);
-layout (std140,binding=2) uniform nodesUbo{ uint max_nodes;};
+layout (location = 5) uniform bool opaque = false;  // depth tested, not sorted
 in vec3 c_norm;
-out vec4 fcolor;
 void main() {
+   vec4 fcolor;
    vec3 facenorm;
-   uint index;
-   uint old_head;
-   uvec4 item;
 
   if (gl_FrontFacing)
      facenorm = c_norm;
@@ -761,19 +812,14 @@ void main() {
    float diffuse = max(0.0,dot(facenorm,light_dir));
    vec3 scattered = ambient + light_color * diffuse;
    vec3 rgb = min(structColor*scattered,vec3(1.0));
-   fcolor = vec4(rgb,trans);
-
-   if (fcolor.a > 0)
+   if (opaque)
    {
-      index = atomicCounterIncrement(list_counter);
-      if (index < max_nodes)
-      {
-         old_head = imageAtomicExchange(head_pointer, ivec2(gl_FragCoord.xy),index);
-         nodes[index].color=fcolor;
-         nodes[index].depth=gl_FragCoord.z;
-         nodes[index].next=old_head;
-      }
+      opaqueOut(vec4(rgb,1.0));
+      return;
    }
+   fcolor = vec4(rgb,region_trans);
+
+   transOut(fcolor);
 }
 )";
 
@@ -783,9 +829,11 @@ void main() {
 // Now render the result to the frame buffer
 const char* finalRenderVSrc =
 R"(
-#version 430
 in vec4 vp;
 void main() {
+#ifdef VS_VIEWS
+  gl_ViewportIndex = EYE;
+#endif
   gl_Position = vp;
 }
 )";
@@ -793,49 +841,17 @@ void main() {
 
 const char* finalRenderGSrc =
 R"(
-#version 430
-#define CONTROL_ONLY     0
-#define CONTROL_STEREO   1
-#define CTL_STIM_PAIR    2
-#define CTL_PART         3
-#define STIM_PART        4
-#define STIM_ONLY        5
-#define STIM_STEREO      6
-#define DELTA_ONLY       7
-#define DELTA_STEREO     8
-#define CTRLSIB_PAIR     9
-#define CTRLSIB_ONLY    10
-#define CTRLSIB_STEREO  11
-#define CTRLSIB_PART    12
-#define STIMSIB_PAIR    13
-#define STIMSIB_ONLY    14
-#define STIMSIB_STEREO  15
-#define STIMSIB_PART    16
-layout(triangles, invocations=2) in;
+layout(triangles, invocations=EYES) in;
 layout(triangle_strip,max_vertices=3) out;
-layout (binding=4) uniform useStereo{ int stereo;};
 void main() {
    int i;
-   bool is_stereo;
-   if (stereo==CONTROL_STEREO || stereo==CTL_STIM_PAIR || 
-       stereo==STIM_STEREO || stereo==DELTA_STEREO ||
-       stereo==CTRLSIB_PAIR || stereo==STIMSIB_PAIR || 
-       stereo==CTRLSIB_STEREO || stereo==STIMSIB_STEREO)
-      is_stereo = true;
-   else
-      is_stereo=false;
-
-      // draw nothing on 2nd invocation if in non-stereo mode
-   if (is_stereo || ((!is_stereo) && gl_InvocationID == 0))
+   for (i = 0; i < gl_in.length(); i++)
    {
-      for (i = 0; i < gl_in.length(); i++)
-      {
-         gl_Position = gl_in[i].gl_Position;
-         gl_ViewportIndex = gl_InvocationID;
-         EmitVertex();
-      }
-      EndPrimitive();
+      gl_Position = gl_in[i].gl_Position;
+      gl_ViewportIndex = EYE;
+      EmitVertex();
    }
+   EndPrimitive();
 }
 )";
 
@@ -848,7 +864,7 @@ const char* finalRenderFSrc =
 R"(
 #version 430
 struct OITNode {
-   vec4 color;
+   uint color;     // packed rgba8
    float depth;
    uint next;
    };
@@ -856,7 +872,6 @@ layout (binding = 0, r32ui) uniform uimage2D head_pointer;
 layout (binding = 0,std430) buffer list_buffer { OITNode nodes[]; };
 //layout (binding = 9) buffer  NC { uint node_counter; };
 layout (location = 0) out vec4 color;
-layout (location = 1) uniform vec4 backColor;
 #define MAX_FRAGMENTS 400      // Max number of overlapping fragments per (x,y)
 void main(void)
 {
@@ -865,7 +880,8 @@ void main(void)
    OITNode next_ode;
    uint index;
    uint count = 0;
-   vec4 final_color = vec4(backColor.xyz,0); // trasparent background by default
+   vec4 final_color = vec4(0);   // premultiplied, blended over the opaque pass
+   float trans_left = 1.0;
    uvec4 pix;
    vec4 next_color;
    uint i, j1, j2, k;
@@ -884,6 +900,8 @@ void main(void)
       index = sort_list[count].next;
       count++;
    }
+   if (count == 0)   // leave what the opaque pass drew
+      discard;
 //   atomicMax(node_counter,count); // xpments show about 240 is max
 
    while (s_step <= count)
@@ -915,8 +933,9 @@ void main(void)
        // figure out final color
    for (i = 0; i < count; i++)      // work sorted list, front to back
    {
-      next_color = sort_list[i].color;
+      next_color = unpackUnorm4x8(sort_list[i].color);
       final_color = mix(final_color,next_color,next_color.a);
+      trans_left *= 1.0 - next_color.a;
        // if any pix is at same z, all bets are off
        // later...it turns out there sometimes a lot of hits, more
        // than 20 or 30...so....?
@@ -930,6 +949,7 @@ void main(void)
 //             b0 = b0+0.05;
        }
    }
+   final_color.a = 1.0 - trans_left;   // coverage of what is behind
     // debugging -- array limis
 //   if ( i == 0)
 //      final_color=vec4(1,0,0,1);
@@ -950,6 +970,356 @@ void main(void)
 )";
 //#endif
 
+// Second pass for the k-buffer engine, reads the same lists. Keeps the K
+// nearest fragments, sorted as they are read, and lumps anything farther
+// into a tail that is averaged like the weighted engine does. Work and
+// registers per pixel are bounded, exact if a pixel has K layers or less.
+// kBufferProgram() puts the version and K ahead of this.
+const char* kBufferFSrc =
+R"(
+struct OITNode {
+   uint color;     // packed rgba8
+   float depth;
+   uint next;
+   };
+layout (binding = 0, r32ui) uniform uimage2D head_pointer;
+layout (binding = 0,std430) buffer list_buffer { OITNode nodes[]; };
+layout (location = 0) out vec4 color;
+
+void toTail(uint rgba, inout vec4 sum, inout float left)
+{
+   vec4 frag = unpackUnorm4x8(rgba);
+   sum += vec4(frag.rgb * frag.a,frag.a);
+   left *= 1.0 - frag.a;
+}
+
+void main(void)
+{
+   uint kcolor[K];       // nearest first
+   float kdepth[K];
+   int count = 0;
+   vec4 tail_sum = vec4(0);
+   float tail_left = 1.0;
+   vec4 result = vec4(0);   // premultiplied, blended over the opaque pass
+   OITNode node;
+   int i;
+
+   uint index = imageLoad(head_pointer, ivec2(gl_FragCoord.xy)).x;
+   while (index != 0xFFFFFFFF)
+   {
+      node = nodes[index];
+      index = node.next;
+      if (count == K)
+      {
+         if (node.depth >= kdepth[K-1])   // behind all we keep
+         {
+            toTail(node.color,tail_sum,tail_left);
+            continue;
+         }
+         toTail(kcolor[K-1],tail_sum,tail_left);   // bump the farthest
+         count = K - 1;
+      }
+      for (i = count; i > 0 && kdepth[i-1] > node.depth; --i)
+      {
+         kcolor[i] = kcolor[i-1];
+         kdepth[i] = kdepth[i-1];
+      }
+      kcolor[i] = node.color;
+      kdepth[i] = node.depth;
+      ++count;
+   }
+   if (count == 0)   // leave what the opaque pass drew
+      discard;
+
+   if (tail_sum.a > 0.0)   // the tail is behind the rest
+      result = vec4(tail_sum.rgb / tail_sum.a,1.0) * (1.0 - tail_left);
+   for (i = count - 1; i >= 0; --i)
+   {
+      vec4 frag = unpackUnorm4x8(kcolor[i]);
+      result = vec4(frag.rgb * frag.a,frag.a) + result * (1.0 - frag.a);
+   }
+   color = result;
+}
+)";
+
+// Second pass for the weighted and peeling engines, over the whole window.
+// mode 0: first is the weighted sum, second how much shows through it
+// mode 1: first is a peeled back layer, blended over the back ones
+// mode 2: first is the peeled front layers, second the back ones
+// mode 3: first is the compute resolve, second marks the tiles it wrote
+// Output is premultiplied, blended over the opaque pass. TILE, the size of
+// the resolve's tiles, goes in front with the #version.
+const char* oitComposeFSrc =
+R"(
+layout (binding = 1) uniform sampler2D first;
+layout (binding = 2) uniform sampler2D second;
+layout (location = 0) uniform int mode = 0;
+layout (location = 0) out vec4 color;
+void main(void)
+{
+   ivec2 pix = ivec2(gl_FragCoord.xy);
+   vec4 val = texelFetch(first,pix,0);
+
+   if (mode == 0)
+   {
+      float coverage = 1.0 - texelFetch(second,pix,0).r;
+      if (coverage <= 0.0)
+         discard;
+      color = vec4(val.rgb / clamp(val.a,1e-5,5e4) * coverage,coverage);
+   }
+   else if (mode == 1)
+   {
+      if (val.a == 0.0)
+         discard;
+      color = val;
+   }
+   else if (mode == 2)
+   {
+      color = val + texelFetch(second,pix,0) * (1.0 - val.a);
+      if (color.a == 0.0)
+         discard;
+   }
+   else
+   {
+      if (texelFetch(second,pix / TILE,0).r == 0.0 || val.a == 0.0)
+         discard;
+      color = val;
+   }
+}
+)";
+
+// Reset the OIT head pointers to end of list when glClearTexSubImage
+// is not available. One invocation per pixel in the window.
+const char* headClearCSrc =
+R"(
+#version 430
+layout (local_size_x = 16, local_size_y = 16) in;
+layout (binding = 0, r32ui) uniform writeonly uimage2D head_pointer;
+layout (location = 0) uniform ivec2 size;
+void main(void)
+{
+   ivec2 pos = ivec2(gl_GlobalInvocationID.xy);
+   if (all(lessThan(pos,size)))
+      imageStore(head_pointer,pos,uvec4(0xFFFFFFFF));
+}
+)";
+
+// Compute resolve of the per-pixel lists, see resolveTiles(). These go
+// after cellShadeSrc and the sizes below, tilePrograms() puts them in front.
+// TILE:         tiles are TILE x TILE pixels
+// TILE_BINS:    most tiles the window can have, each class's list is this long
+// TILE_CLASSES: number of classes, the empty one included
+// SHORT_MAX, MEDIUM_MAX, LONG_MAX: longest list each class sorts
+// TILE_CLASS:   which class a sort kernel is for, an OIT_TILE_CLASS
+// MAX_FRAGMENTS: its local array size
+const char* tileDeclSrc =
+R"(
+struct OITNode {
+   uint color;     // packed rgba8
+   float depth;
+   uint next;
+   };
+struct Dispatch {
+   uint x, y, z;
+   };
+layout (binding = 0, r32ui) uniform readonly uimage2D head_pointer;
+layout (binding = 0,std430) readonly buffer list_buffer { OITNode nodes[]; };
+   // indirect dispatch per class, then the tiles in each class
+layout (binding = 6,std430) buffer tile_bins { Dispatch work[TILE_CLASSES]; uint tiles[]; };
+layout (location = 0) uniform ivec2 size;
+layout (location = 1) uniform float cell_trans = 0.5;
+
+// Deferred cell nodes hold the cell's row and its light, color them for
+// the current phase the way the cell shader would have.
+vec4 nodeColor(OITNode node)
+{
+   if ((floatBitsToUint(node.depth) & 0x80000000u) == 0)
+      return unpackUnorm4x8(node.color);
+   vec3 scattered = vec3(float(node.color >> 24) / 127.5);
+   vec3 rgb = min(cellColor(int(node.color & 0xFFFFFF)).rgb * scattered,vec3(1.0));
+   return vec4(rgb,cell_trans);
+}
+)";
+
+// First pass, one work group per tile. Finds the longest list in the tile,
+// marks whether it has any, and adds it to the bin for that length.
+const char* tileClassCSrc =
+R"(
+layout (local_size_x = TILE, local_size_y = TILE) in;
+layout (binding = 2, r8) uniform writeonly image2D tile_used;
+shared uint longest;
+void main(void)
+{
+   ivec2 pos = ivec2(gl_GlobalInvocationID.xy);
+   uint index, count = 0;
+   uint cls, slot;
+
+   if (gl_LocalInvocationIndex == 0)
+      longest = 0;
+   barrier();
+   if (all(lessThan(pos,size)))
+   {
+      index = imageLoad(head_pointer,pos).x;
+      while (index != 0xFFFFFFFF && count <= LONG_MAX)
+      {
+         index = nodes[index].next;
+         count++;
+      }
+      atomicMax(longest,count);
+   }
+   barrier();
+   if (gl_LocalInvocationIndex != 0)
+      return;
+
+   if (longest == 0)   // TILE_CLASS, 0 is empty
+      cls = 0;
+   else if (longest <= SHORT_MAX)
+      cls = 1;
+   else if (longest <= MEDIUM_MAX)
+      cls = 2;
+   else
+      cls = 3;
+   imageStore(tile_used,ivec2(gl_WorkGroupID.xy),vec4(cls == 0 ? 0.0 : 1.0));
+   slot = atomicAdd(work[cls].x,1);
+   if (cls != 0)
+      tiles[cls * TILE_BINS + slot] = gl_WorkGroupID.x | (gl_WorkGroupID.y << 16);
+}
+)";
+
+// Short and medium tiles, one invocation per pixel. The lists fit in
+// registers, so insertion sort them as they are read, nearest first.
+const char* tileSortCSrc =
+R"(
+layout (local_size_x = TILE, local_size_y = TILE) in;
+layout (binding = 1, rgba8) uniform writeonly image2D resolved;
+void main(void)
+{
+   uint kcolor[MAX_FRAGMENTS];
+   float kdepth[MAX_FRAGMENTS];
+   uint tile = tiles[TILE_CLASS * TILE_BINS + gl_WorkGroupID.x];
+   ivec2 pos = ivec2(tile & 0xFFFF,tile >> 16) * TILE + ivec2(gl_LocalInvocationID.xy);
+   vec4 result = vec4(0);   // premultiplied, blended over the opaque pass
+   vec4 frag;
+   OITNode node;
+   float depth;
+   uint index;
+   int count = 0;
+   int i;
+
+   if (any(greaterThanEqual(pos,size)))
+      return;
+   index = imageLoad(head_pointer,pos).x;
+   while (index != 0xFFFFFFFF && count < MAX_FRAGMENTS)
+   {
+      node = nodes[index];
+      index = node.next;
+      depth = abs(node.depth);
+      for (i = count; i > 0 && kdepth[i-1] > depth; --i)
+      {
+         kcolor[i] = kcolor[i-1];
+         kdepth[i] = kdepth[i-1];
+      }
+      kcolor[i] = packUnorm4x8(nodeColor(node));
+      kdepth[i] = depth;
+      ++count;
+   }
+   for (i = count - 1; i >= 0; --i)
+   {
+      frag = unpackUnorm4x8(kcolor[i]);
+      result = vec4(frag.rgb * frag.a,frag.a) + result * (1.0 - frag.a);
+   }
+   imageStore(resolved,pos,result);
+}
+)";
+
+// Long tiles, a work group per pixel. One invocation reads the list into
+// shared memory, then all of them bitonic merge sort it, nearest first.
+// Lists longer than LONG_MAX show magenta, like the fragment resolve.
+const char* tileMergeCSrc =
+R"(
+#define SORT_GROUP 64
+layout (local_size_x = SORT_GROUP) in;
+layout (binding = 1, rgba8) uniform writeonly image2D resolved;
+shared uint scolor[LONG_MAX];
+shared float sdepth[LONG_MAX];
+shared uint scount, spadded;
+shared bool soverflow;
+void main(void)
+{
+   uint tile = tiles[TILE_CLASS * TILE_BINS + gl_WorkGroupID.x];
+   ivec2 pos = ivec2(tile & 0xFFFF,tile >> 16) * TILE
+             + ivec2(gl_WorkGroupID.y % TILE,gl_WorkGroupID.y / TILE);
+   uint me = gl_LocalInvocationIndex;
+   vec4 result = vec4(0);
+   vec4 frag;
+   OITNode node;
+   uint index, count, padded;
+   uint i, j, k, other;
+   float depth;
+   uint color;
+
+   if (any(greaterThanEqual(pos,size)))   // same for the whole group
+      return;
+   if (me == 0)
+   {
+      index = imageLoad(head_pointer,pos).x;
+      count = 0;
+      while (index != 0xFFFFFFFF && count < LONG_MAX)
+      {
+         node = nodes[index];
+         index = node.next;
+         scolor[count] = packUnorm4x8(nodeColor(node));
+         sdepth[count] = abs(node.depth);
+         count++;
+      }
+      scount = count;
+      soverflow = index != 0xFFFFFFFF;
+      for (padded = 1; padded < count; padded *= 2)
+         ;
+      spadded = padded;
+   }
+   memoryBarrierShared();
+   barrier();
+   count = scount;
+   padded = spadded;
+   for (i = count + me; i < padded; i += SORT_GROUP)
+      sdepth[i] = 2.0;             // past the far plane, sorts to the end
+   memoryBarrierShared();
+   barrier();
+
+   for (k = 2; k <= padded; k *= 2)
+      for (j = k / 2; j > 0; j /= 2)
+      {
+         for (i = me; i < padded; i += SORT_GROUP)
+         {
+            other = i ^ j;
+            if (other > i && (sdepth[i] > sdepth[other]) == ((i & k) == 0))
+            {
+               depth = sdepth[i];
+               sdepth[i] = sdepth[other];
+               sdepth[other] = depth;
+               color = scolor[i];
+               scolor[i] = scolor[other];
+               scolor[other] = color;
+            }
+         }
+         memoryBarrierShared();
+         barrier();
+      }
+
+   if (me != 0)
+      return;
+   for (i = count; i > 0; --i)
+   {
+      frag = unpackUnorm4x8(scolor[i-1]);
+      result = vec4(frag.rgb * frag.a,frag.a) + result * (1.0 - frag.a);
+   }
+   if (soverflow)
+      result = vec4(1,0,1,1);
+   imageStore(resolved,pos,result);
+}
+)";
+
 #if 0
 //////////////////////////
 // Sorting the frags is a bottleneck, alternative sorts were tried.
@@ -34,6 +34,9 @@ This file is part of the USF Brainstem Data Visualization suite.
 #include <QtPrintSupport/QPrinter>
 #include <QOpenGLDebugMessage>
 #include <QOpenGLDebugLogger>
+#include <QOpenGLContext>
+#include <QOffscreenSurface>
+#include <QThread>
 
 #define GLM_FORCE_CXX1Y
 #define GLM_FORCE_RADIANS
@@ -65,13 +68,13 @@ This file is part of the USF Brainstem Data Visualization suite.
 const GLenum PrintTexture = GL_TEXTURE0;
 const GLenum ListTexture = GL_TEXTURE1;
 
-using glCTH = struct glCTHStruct {GLuint vao; size_t cellSize[NUM_PT_LISTS];}; 
+using glCTH = struct glCTHStruct {GLuint first[NUM_PT_LISTS]; GLsizei cellSize[NUM_PT_LISTS];
+                                  GLuint lod[NUM_PT_LISTS];};   // its first LOD draw
 using cellList = std::vector<GLint>;
 using cellListIter = cellList::iterator;
 
-using vaoCellList = std::map<int, std::vector<glCTH>>;
-using vaoCellListIter = vaoCellList::iterator;
-using vaoCellInsert = std::pair<int, glCTH>;
+using cellRowList = std::map<int, glCTH>;   // rows in the cell table
+using cellRowListIter = cellRowList::iterator;
 
 using colorBright = std::vector<glm::vec4>;
 using colorBrightIter = colorBright::iterator;
@@ -80,8 +83,69 @@ using colorBrightIter = colorBright::iterator;
 // send to openGL
 using ptCoords = std::vector<glm::vec3>;
 using ptCoordsIter = ptCoords::iterator;
-using colorIdx = std::vector<std::vector<GLint> >; 
-using colorIdxIter = colorIdx::iterator; 
+
+// One cell in the shader's cell table, std430 packs this in 16 bytes
+struct cellRow {
+   glm::vec3 pos;
+   GLint offset;     // start of cell's color shades in table, -1 for delta
+};
+using cellTable = std::vector<cellRow>;
+
+// One cluster's worth of cells from one period list, gathered with their
+// normalized CTHs.  Kept across experiment (de)selections.
+class cthBlock
+{
+   public:
+      ptCoords coords;              // cell positions
+      std::vector<int> expIdx;      // experiment each cell is from
+      std::vector<GLint> offset;    // start of cell's color shades in table
+      std::vector<GLfloat> normCth; // numBins values for each cell
+      bool delta = false;           // deltas use their own table
+};
+using cthCache = std::array<std::map<int,cthBlock>,NUM_CELL_COLORS>;
+
+// The cell and CTH tables for one update, and the buffers they end up in.
+// The upload thread fills in the buffers and a fence the GUI thread waits
+// on before swapping them in.
+class cellUpload
+{
+   public:
+      cellTable cells;
+      std::vector<GLfloat> cths;
+      cellRowList ranges;            // where each cluster's lists are
+      size_t generation = 0;         // stale if a newer one was asked for
+      GLuint cellTabVbo = 0;
+      GLuint cthTabVbo = 0;
+      GLuint rowVbo = 0;
+      GLsync fence = nullptr;
+};
+using cellUploadPtr = std::shared_ptr<cellUpload>;
+Q_DECLARE_METATYPE(cellUploadPtr)
+
+// Lives in its own thread with a context that shares objects with the
+// widget's, so big uploads don't stall drawing.
+class cellUploader : public QObject, protected QOpenGLFunctions_4_3_Core
+{
+   Q_OBJECT
+
+   public:
+      explicit cellUploader(QObject *parent = nullptr);
+      virtual ~cellUploader();
+      bool share(QOpenGLContext*);
+      bool useCurrent();
+      void send(cellUpload&);
+
+   signals:
+      void uploaded(cellUploadPtr);
+
+   public slots:
+      void upload(cellUploadPtr);
+
+   private:
+      QOpenGLContext *uploadContext = nullptr;
+      QOffscreenSurface *surface = nullptr;
+      bool haveFuncs = false;
+};
 
 class oneStruct
 {
@@ -93,17 +157,109 @@ class oneStruct
 
 const int MAX_FB_WIDTH=2048;  // 4K displays or many monitors overflow
 const int MAX_FB_HEIGHT=2048; // buffers, clip physical screen to this.
+const int HEAD_CLEAR_GROUP=16;  // head pointer clear compute shader is 16x16
+const int FRAME_SLOTS=3;      // per-frame uniform ring, triple buffered
+const GLuint64 FENCE_WAIT=1000000000; // 1 sec in ns, way more than a frame
+
+// Sphere meshes for cells come in levels of detail, an icosahedron split
+// into 4 times the triangles for each level after it. Each list in the
+// cell table has a draw per level, the cull pass fills in the cells each
+// one draws that can be seen, see cullCells().
+const int SPHERE_LODS=4;         // 20, 80, 320, 1280 triangles
+const float SPHERE_RADIUS=1.3;   // before the point size scales it
+const int LOD_GROUP=64;          // cull compute shader's work group size
+struct lodCommand {              // glMultiDrawArraysIndirect's
+   GLuint count;
+   GLuint instances;
+   GLuint first;
+   GLuint baseInstance;
+};
+using lodCommands = std::vector<lodCommand>;
 
-// Shaders use this for building Order Independent Transparency (OIT) linked lists
+// Shaders use this for building Order Independent Transparency (OIT) linked lists.
+// Color is packed rgba8, depth stays a full float, squeezing it breaks zooming.
 struct oitNode {
-   glm::vec4 color;
+   GLuint color;
    GLfloat depth;
    GLuint next;
 };
 
 // glsl thinks the above struct is this big
-const GLint OIT_NODE_SIZE=5*sizeof(GLfloat)+sizeof(GLuint); 
-const GLuint MAX_OIT_NODES = 27 * MAX_FB_WIDTH*MAX_FB_HEIGHT;  // max nodes
+const GLint OIT_NODE_SIZE=sizeof(oitNode); 
+
+// Lighting, materials, and the cell point size, lightUbo in the cell, skin,
+// and structure shaders, see lightSrc. Same layout as std140 gives it.
+struct lightBlock {
+   glm::vec3 ambient;
+   GLfloat skinTrans;
+   glm::vec3 lightColor;
+   GLfloat cellTrans;
+   glm::vec3 lightDir;
+   GLfloat regionTrans;
+   GLint scale;
+   GLint hideOff;
+   GLint surfaceSel;
+   GLint pad;
+};
+const double OIT_DEPTH=8.0;   // default avg fragments per pixel the node pool holds
+const double OIT_GROW=1.25;   // on overflow, make the pool this much more than was wanted
+const int OIT_POLL_MS=20;     // look for finished frames' node counts this often
+
+// Ways to draw the translucent layer. The lists are exact, but need memory
+// for every fragment. Weighted blending is one pass in fixed memory, but an
+// approximation. Depth peeling is fixed memory and exact up to 2*PEEL_PASSES
+// layers, but takes a pass for every two. The k-buffer builds the same
+// lists, but only sorts the nearest few fragments, bounding the cost of the
+// second pass.
+enum OIT_ENGINE {OIT_LISTS=0, OIT_WEIGHTED, OIT_PEEL, OIT_KBUFFER, OIT_ENGINES};
+
+// The programs that draw into the viewports are built for each view with it
+// baked in, see viewHead(), rather than asking a uniform which stereo mode
+// this is. The stereo view draws both viewports in one pass. Only the cells
+// draw the right half of a pair by itself, the mono view does the left.
+// NO_VIEW shaders don't pick a viewport.
+enum STEREO_VIEW {NO_VIEW=-1, MONO_VIEW, STEREO_VIEW, RIGHT_VIEW, CELL_VIEWS};
+const int VIEWS=RIGHT_VIEW;   // everything but the cells
+
+// One stage of a program for buildProgram(): the head, the #version and
+// any #defines, goes in front of the sources. Sources with their own
+// #version have an empty head.
+struct shaderSrcs {
+   GLenum type;
+   std::string head;
+   std::vector<const char*> srcs;
+};
+
+// A program buildProgram() started, finishPrograms() waits for it
+struct pendingProgram {
+   GLuint *prog;
+   QString file;        // its cache file
+   const char* name;
+};
+
+// What the translucent fragment shaders are doing, see oitFragSrc
+enum OIT_PASS {LIST_PASS=0, WEIGHTED_PASS, PEEL_INIT_PASS, PEEL_PASS, OVER_PASS};
+
+// Color attachments of the transparency framebuffer. The peeling depths and
+// backs are ping-pong pairs, the fronts are blended under each other. The
+// lists keep a copy of the opaque pass, so color cycling can resolve them
+// again over it.
+enum OIT_TARGET {LIST_OPAQUE=0, WB_ACCUM=0, WB_REVEAL, 
+                 PEEL_DEPTH=0, PEEL_FRONT=2, PEEL_BACK=3, PEEL_BLEND=5,
+                 OIT_TARGETS=6};
+const int PEEL_PASSES=8;      // peels at most 16 layers, drops the middle of deeper ones
+const int KBUFFER_SIZE=16;    // default nearest fragments the k-buffer sorts
+const int KBUFFER_MIN=2;
+const int KBUFFER_MAX=64;
+
+// The list engine resolves in compute shaders. Tiles are binned by their
+// longest list and each bin gets a sort sized for it.
+enum OIT_TILE_CLASS {TILE_EMPTY=0, TILE_SHORT, TILE_MEDIUM, TILE_LONG, TILE_CLASSES};
+const int OIT_TILE=16;        // tiles are 16x16 pixels
+const int TILE_BINS=((MAX_FB_WIDTH+OIT_TILE-1)/OIT_TILE) * ((MAX_FB_HEIGHT+OIT_TILE-1)/OIT_TILE);
+const int TILE_SHORT_MAX=8;   // longest list each class sorts
+const int TILE_MEDIUM_MAX=32;
+const int TILE_LONG_MAX=512;  // in shared memory, a power of 2
 
 using brainStructs = std::vector<oneStruct>; 
 using structuresFirst = std::vector<GLint>;
@@ -127,6 +283,7 @@ class BrainStemGL : public QOpenGLWidget, protected QOpenGLFunctions_4_3_Core
    signals:
       void chatBox(QString);
       void movieUpd(QString);
+      void uploadCells(cellUploadPtr);
 
    protected:
       void initializeGL();
@@ -139,6 +296,7 @@ class BrainStemGL : public QOpenGLWidget, protected QOpenGLFunctions_4_3_Core
    public slots:
 
    protected slots:
+      void swapCells(cellUploadPtr);
 
    private:
       void extremes();
@@ -148,8 +306,54 @@ class BrainStemGL : public QOpenGLWidget, protected QOpenGLFunctions_4_3_Core
       void printBox();
       void skin();
       void sphere();
+      void lodLists();
+      bool cellListShown(int);
+      void cullCells();
       void stemStructs();
       void oit();
+      void oitPool(int,int);
+      void oitHeads(int,int);
+      void clearHeads();
+      void setOitEngine(int);
+      void setKBuffer(int);
+      void setImpostors(bool);
+      void kBufferProgram();
+      void tilePrograms();
+      void resolveTiles();
+      void recolorLists();
+      void paintOver();
+      void endFrame();
+      void sceneUpdate();
+      void colorUpdate();
+      void cellsUpdate();
+      void oitTargets(int,int);
+      void oitPass(GLint);
+      bool copyDepth();
+      void compose(GLint,GLuint,GLuint);
+      void paintTranslucent();
+      void paintStaticLayer();
+      void paintDynamicLayer();
+      void staticLayer();
+      void paintLists();
+      void paintWeighted();
+      void paintPeeled();
+      void frameRing();
+      void cellLoader();
+      void nextFrameSlot();
+      bool oitCount(int);
+      void pollOitCount();
+      QImage grabComplete();
+      std::string viewHead(GLenum, int);
+      void viewPrograms(GLuint*, int, const std::vector<const char*>&, const std::vector<const char*>&,
+                        const shaderSrcs&, const char*);
+      void buildProgram(GLuint*, const std::vector<shaderSrcs>&, const char*);
+      void finishPrograms();
+      QString programFile(const std::vector<shaderSrcs>&);
+      GLuint loadProgram(const QString&);
+      void saveProgram(GLuint, const QString&);
+      std::vector<GLuint> cellPrograms();
+      GLuint cellCopies();
+      void frameLights(GLintptr);
       void printInfo(QString&);
       void clearInfo();
       void reset();
@@ -172,12 +376,20 @@ class BrainStemGL : public QOpenGLWidget, protected QOpenGLFunctions_4_3_Core
       void rotateY();
       void rotateZ();
       void toggleStereo(STEREO_MODE);
-      void updateCells(bool,bool,bool,std::vector<int>&,std::vector<int>&,cellArray&,ClustRGB&,bool);
+      void updateCells(bool,bool,bool,std::vector<int>&,std::vector<int>&,cellArray&,sibArray&,ClustRGB&,bool);
       void createShades(ClustRGB&);
+      void gatherCells(cellArray&,sibArray&);
+      void addCell(cthBlock&,OneRec&);
+      void visibleCells(cthBlock&,std::vector<int>&,cellTable&,std::vector<GLfloat>&);
+      void drawCells(glCTH&,int);
+      void paintSkin(bool);
+      void paintStructs(bool);
+      void paintCells(bool);
       void updateCellProg();
       void doToggleColorCycling(bool);
       void doTwinkleChanged(int);
-      void twinkleAgain();
+      void twinkleAgain(double step=1.0);
+      int  phrenicPos(size_t);
       int  newFrame();
       void singleTwinkle(bool);
       void singleStep(bool);
@@ -195,10 +407,13 @@ class BrainStemGL : public QOpenGLWidget, protected QOpenGLFunctions_4_3_Core
       void doSurfaceT();
       void doSurfaceW();
       void clearClusts();
+      void freeCells();
+      void freeUpload(cellUpload&);
       void applyPrefs();
       void doOrtho();
       void doPerspec();
       void doFov(int);
+      void setOitDepth(double);
       void showCtlStim(STEREO_MODE);
       void saveFig(QTextStream &);
       void loadFig(QTextStream &);
@@ -231,6 +446,7 @@ class BrainStemGL : public QOpenGLWidget, protected QOpenGLFunctions_4_3_Core
       GLfloat dX= 0.0;
       GLfloat dY= 0.0;
       GLfloat dZ= 1.0;
+      int surfaceSel = 0;   // skin color, 0 is tan, 1 white
 
         // viewport
       float xlo= 0.0, xhi= 0.0, ylo= 0.0, yhi= 0.0, zlo= 0.0, zhi= 0.0;
@@ -254,6 +470,7 @@ class BrainStemGL : public QOpenGLWidget, protected QOpenGLFunctions_4_3_Core
       unsigned int timerSpin;
       unsigned int timerTwinkle;
       size_t currCycle=0;
+      double cyclePhase=0.0;    // bin plus fraction to the next one
 
       size_t numBins=0;
       bool   twinkleMode=false;
@@ -266,12 +483,43 @@ class BrainStemGL : public QOpenGLWidget, protected QOpenGLFunctions_4_3_Core
       float viewPortH;
 
       // for vertex sorting so transparency works
-      GLuint headPointerTex;
-      GLuint headPointerInitVal;
-      GLuint atomicCounterBuff;
-      GLuint linkedListBuff, linkedListTex;
-      GLuint sortVs, sortGs, sortFs, sort_skinProg = 0;
-      GLuint finalRenderVs, finalRenderGs, finalRenderFs, finalRenderProg = 0;
+      GLuint headPointerTex = 0;
+      GLsizei headTexW = 0, headTexH = 0;   // it and the resolve's targets, see oitHeads()
+      PFNGLCLEARTEXSUBIMAGEPROC clearTexSubImage = nullptr;
+      GLuint headClearProg = 0;  // if no clearTexSubImage
+      GLuint linkedListBuff = 0, linkedListTex;
+      GLuint oitNodes = 0;          // node pool size
+      GLint64 maxOitNodes = 0;      // what a storage block can hold
+      double oitDepth = OIT_DEPTH;  // avg depth complexity to size the pool for
+      int oitEngine = OIT_LISTS;
+      GLuint oitFbo = 0;            // weighted and peeling engines draw here
+      GLuint oitDepthTex = 0;       // copy of the opaque pass's depth
+      GLuint oitTex[OIT_TARGETS] = {};
+      GLsizei oitTexW = 0, oitTexH = 0;
+      int oitTexEngine = -1;        // what oitTex was made for
+      GLuint composeProgs[VIEWS] = {};
+      GLuint kBufferProgs[VIEWS] = {};
+      int kBufferSize = KBUFFER_SIZE;
+      GLuint tileClassProg = 0;     // compute resolve, tileSortProg[TILE_EMPTY] is unused
+      GLuint tileSortProg[TILE_CLASSES] = {};
+      GLuint tileBinBuff = 0, resolveTex = 0, tileUsedTex = 0;
+      bool tileResolve = false;     // all of the above built
+      bool deferCells = false;      // cells go in the lists as rows, see recolorLists()
+      bool listsDeferred = false;   // the lists were built that way
+      bool listsStale = true;       // something but the cell colors changed since
+      GLuint staticHeadTex = 0;     // lists of the skin and structures, see staticLayer()
+      GLuint staticCountBuff = 0;   // and how many nodes they took
+      bool staticLists = false;     // this frame starts from them
+      bool staticStale = true;      // camera or scene changed since they were kept
+      GLuint peelQuery[PEEL_PASSES] = {};   // samples each peel's back layer added
+      bool peelQueried = false;     // last frame's are in flight
+      bool peelCapShown = false;    // told the chat box the passes ran out
+      bool transPrint = false;      // what is in this frame's translucent layer
+      bool transSkin = false;
+      bool transStructs = false;
+      bool transCells = false;
+      GLuint sort_skinProgs[VIEWS] = {};
+      GLuint finalRenderProgs[VIEWS] = {};
       GLuint showVao, showVbo;
 
          // outlines VAO, VBO 
@@ -280,14 +528,10 @@ class BrainStemGL : public QOpenGLWidget, protected QOpenGLFunctions_4_3_Core
       GLuint outlinesIdx = 0;
       GLuint outlinesIdxBuf = 0;
       GLuint outlinesIdxSize;
-      GLint  outlineColor = 1.0;  // uniforms
-      GLuint outlineFShader;
       glm::vec4 outlineColorVal = glm::vec4(1.0, 1.0, 1.0, 1.0);
 
        // UBO for common transform matrix
-      GLuint vUbo;
       GLuint vUboBlkId = 1;
-      GLuint vUboBuff;
 
        // UBO for max OIT buffer size
       GLuint nodeUbo;
@@ -295,34 +539,57 @@ class BrainStemGL : public QOpenGLWidget, protected QOpenGLFunctions_4_3_Core
       GLuint nodeBuff;
 
        // UBO for common transform matrix for lighting normals
-      GLuint nUbo;
       GLuint nUboBlkId = 3;
-      GLuint nUboBuff;
-      GLuint stereoMode=0;
 
-        // UBO for stereo mode
-      GLuint sUbo;
-      GLuint sUboBlkId = 4;
-      GLuint sUboBuff;
+       // UBO for lighting, materials, and point size, see frameLights()
+      GLuint lightUboBlkId = 4;
+      GLuint stereoMode=0;
+      int stereoView = MONO_VIEW;   // which build of the programs draws
+      bool vsViewports = false;     // built with the vertex shaders picking the viewport
+      const char* vsViewportExt = nullptr;
+      GLsizei viewInstances = 1;    // with vsViewports, one per eye in the stereo view
+      QString shaderCache;          // linked program binaries, none if empty
+      QByteArray shaderCacheId;     // the driver that built them
+      int cachedPrograms = 0;
+      int builtPrograms = 0;
+      std::vector<pendingProgram> pendingProgs;
+
+        // Per-frame transforms, lighting, and atomic counter, FRAME_SLOTS
+        // copies in one buffer. Persistently mapped if the driver can do it.
+      GLuint frameRingBuff = 0;
+      unsigned char *frameRingPtr = nullptr;
+      GLsync frameFence[FRAME_SLOTS] = {};
+      int frameSlot = 0;
+      GLintptr frameSlotSize = 0;
+      GLintptr mvpOffset = 0;
+      GLintptr mvOffset = 0;
+      GLintptr counterOffset = 0;
+      GLintptr lightOffset = 0;
+      int lightStale = FRAME_SLOTS;   // slots with old lighting in them
+
+        // Each slot's OIT node count is copied here, then read once its
+        // fence is done, so checking for overflow never waits on the gpu.
+      GLuint counterReadBuff = 0;
+      GLuint *counterReadPtr = nullptr;
+      bool counterCopied[FRAME_SLOTS] = {};
+      bool oitPolling = false;
+      GLuint oitPeak = 0;           // most nodes a frame has wanted
+      GLint64 oitGrown = 0;         // pool size overflows have pushed it to
 
         // testing, how many frags stack up?
     GLuint nodeId = 9;
     GLuint nodeCount;
 
           // some progs use the vertex shader
-      GLuint vertVShader;
-      GLuint vertGShader;
       GLuint vertFShader;
-      GLuint outlineProg=0;
+      GLuint outlineProgs[VIEWS] = {};
 
          // axes
       GLuint axesVao = 0;
       GLuint axesVbo = 0;
       GLuint axesVShader;
-      GLuint axesFShader;
       GLuint axesSize = 0;
-      GLuint axesProg=0;
-      GLuint axesColor;
+      GLuint axesProgs[VIEWS] = {};
       glm::vec4 axesColorVec = glm::vec4(0.0, 1.0, 1.0, 1.0);
 
         // transforms, etc.
@@ -333,29 +600,44 @@ class BrainStemGL : public QOpenGLWidget, protected QOpenGLFunctions_4_3_Core
       size_t mvSize;
 
           // cells are complicated due to color cycling
-      vaoCellList cellsVao;
+      cellRowList cellRows;
+      GLuint cellVao=0;
+      GLuint cellTabVbo=0;
+      GLuint cthTabVbo=0;
+      GLuint cellRowVbo=0;
+      GLuint cellLodVao=0;          // rows from the cull pass
+      lodCommands lodInit;          // LOD draws with no cells in them
+      GLuint lodInitVbo=0;
+      GLuint lodDrawVbo=0;          // the cull pass fills in a copy
+      GLuint lodRowVbo=0;           // rows of every list at every level
+      GLuint cellCullProg=0;
+      GLsizei lodListCount=0;       // lists with cells in them
+      GLuint lodCellCount=0;
+      cellUploader *uploader=nullptr;
+      QThread *uploadThread=nullptr;   // null if uploads are done in place
+      std::vector<cellUploadPtr> uploadJobs;   // sent to it, not swapped in yet
+      size_t uploadGen=0;
       colorBright colorTab;
       colorBright oneShadeTab;
       colorBright deltaShadeTab;
       GLuint *vboPointList=nullptr; 
       GLuint *vboColorList=nullptr; 
       std::vector<int>onOff;
-      GLuint cellVShader=0;
-      GLuint cellGShader=0;
-      GLuint cellFShader=0;
-      GLuint cellProg=0;
+      GLuint cellProgs[CELL_VIEWS] = {};
+      GLuint cellImpProgs[CELL_VIEWS] = {};  // impostor spheres
+      bool impostorCells=true;      // draw cells with cellImpProgs if they built
+      bool useImpostors=false;      // this frame does
       GLuint colorTabVbo;
       GLuint deltaTabVbo;
       GLfloat cellTrans=1.0;
       bool haveDelta=false;
+      cthCache cthColors;
 
         // ui box with text & etc as textures
       GLuint printVao;
       GLuint printVbo;
       GLuint texVbo; 
       GLuint printProg=0; 
-      GLuint printVShader; 
-      GLuint printFShader;
       GLuint printTShader;
       GLuint printText;
       GLuint sizeText;
@@ -384,17 +666,15 @@ class BrainStemGL : public QOpenGLWidget, protected QOpenGLFunctions_4_3_Core
       GLuint sphereProg=0;
       GLuint sphereVShader; 
       GLuint sphereFShader;
-      GLuint sphereSize = 0;
+      GLuint sphereFirst[SPHERE_LODS];   // each level's triangles
+      GLuint sphereCount[SPHERE_LODS];
       ptCoords sphereV, sphereN;
 
         // brain structures
-      GLuint structVao;
+      GLuint structVao = 0;         // made when one is first shown
       GLuint structVbo;
       GLuint structNormVbo;
-      GLuint structProg=0;
-      GLuint structVShader; 
-      GLuint structGShader;
-      GLuint structFShader;
+      GLuint structProgs[VIEWS] = {};
       GLfloat regionTrans=0.4;
       brainStructs selStructs; 
       structuresFirst structsFirst;
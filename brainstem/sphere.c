@@ -1,4619 +0,0 @@
-#include <GL/gl.h>
-const GLfloat sphereVert[][3]={
-{-0.7,-0.7,-0.9},
-{-0.6,-0.8,-0.8},
-{-0.7,-0.7,-0.7},
-{-0.7,-0.7,0.9},
-{-0.8,-0.6,0.8},
-{-0.7,-0.7,0.7},
-{0.9,-0.7,0.7},
-{0.8,-0.6,0.8},
-{0.7,-0.7,0.7},
-{-0.7,-0.9,0.7},
-{-0.6,-0.8,0.8},
-{-0.7,-0.7,0.7},
-{-0.9,0.7,0.7},
-{-0.8,0.6,0.8},
-{-0.7,0.7,0.7},
-{-0.7,0.9,-0.7},
-{-0.6,0.8,-0.8},
-{-0.7,0.7,-0.7},
-{-0.8,1.0,0.0},
-{-0.9,0.9,-0.0},
-{-0.9,0.9,0.2},
-{0.3,1.2,0.3},
-{0.3,1.3,0.0},
-{0.0,1.3,0.0},
-{0.2,0.9,-0.9},
-{0.0,0.9,-0.9},
-{0.0,1.0,-0.8},
-{-1.0,0.8,0.0},
-{-0.9,0.9,-0.0},
-{-0.9,0.9,-0.2},
-{-1.2,-0.3,-0.3},
-{-1.3,-0.3,0.0},
-{-1.3,0.0,0.0},
-{-0.9,-0.2,0.9},
-{-0.9,0.0,0.9},
-{-1.0,0.0,0.8},
-{-0.8,-1.0,0.0},
-{-0.9,-0.9,-0.0},
-{-0.9,-0.9,-0.2},
-{0.3,-1.2,-0.3},
-{0.3,-1.3,0.0},
-{-0.0,-1.3,0.0},
-{0.2,-0.9,0.9},
-{-0.0,-0.9,0.9},
-{-0.0,-1.0,0.8},
-{1.0,-0.8,0.0},
-{0.9,-0.9,-0.0},
-{0.9,-0.9,-0.2},
-{1.2,0.3,-0.3},
-{1.3,0.3,0.0},
-{1.3,-0.0,0.0},
-{0.9,0.2,0.9},
-{0.9,-0.0,0.9},
-{1.0,-0.0,0.8},
-{-0.0,-0.8,1.0},
-{-0.0,-0.9,0.9},
-{0.2,-0.9,0.9},
-{0.3,0.3,1.2},
-{-0.0,0.3,1.3},
-{-0.0,-0.0,1.3},
-{-0.9,0.2,0.9},
-{-0.9,0.0,0.9},
-{-0.8,0.0,1.0},
-{-0.8,0.0,-1.0},
-{-0.9,0.0,-0.9},
-{-0.9,0.2,-0.9},
-{0.3,0.3,-1.2},
-{0.3,0.0,-1.3},
-{0.0,0.0,-1.3},
-{0.2,-0.9,-0.9},
-{-0.0,-0.9,-0.9},
-{0.0,-0.8,-1.0},
-{0.3,-0.6,-1.1},
-{0.0,-0.6,-1.2},
-{0.0,-0.3,-1.3},
-{0.7,-0.5,-1.0},
-{0.5,-0.5,-1.1},
-{0.6,-0.3,-1.1},
-{0.6,-0.8,-0.8},
-{0.4,-0.9,-0.9},
-{0.5,-0.7,-1.0},
-{0.3,0.8,-1.0},
-{0.3,0.6,-1.1},
-{0.0,0.6,-1.2},
-{0.7,0.7,-0.9},
-{0.7,0.5,-1.0},
-{0.5,0.5,-1.1},
-{0.8,0.3,-1.0},
-{0.8,-0.0,-1.0},
-{0.6,0.0,-1.2},
-{-0.7,0.5,-1.0},
-{-0.9,0.4,-0.9},
-{-0.8,0.6,-0.8},
-{-0.3,0.6,-1.1},
-{-0.5,0.5,-1.1},
-{-0.5,0.7,-1.0},
-{-0.3,0.0,-1.3},
-{-0.6,0.0,-1.2},
-{-0.6,0.3,-1.1},
-{-0.6,0.3,1.1},
-{-0.6,0.0,1.2},
-{-0.3,-0.0,1.3},
-{-0.5,0.7,1.0},
-{-0.5,0.5,1.1},
-{-0.3,0.6,1.1},
-{-0.8,0.6,0.8},
-{-0.9,0.4,0.9},
-{-0.7,0.5,1.0},
-{0.8,0.3,1.0},
-{0.6,0.3,1.1},
-{0.6,-0.0,1.2},
-{0.7,0.7,0.9},
-{0.5,0.7,1.0},
-{0.5,0.5,1.1},
-{0.3,0.8,1.0},
-{0.0,0.8,1.0},
-{0.0,0.6,1.2},
-{0.5,-0.7,1.0},
-{0.4,-0.9,0.9},
-{0.6,-0.8,0.8},
-{0.6,-0.3,1.1},
-{0.5,-0.5,1.1},
-{0.7,-0.5,1.0},
-{-0.0,-0.3,1.3},
-{-0.0,-0.6,1.2},
-{0.3,-0.6,1.1},
-{1.1,0.3,0.6},
-{1.2,-0.0,0.6},
-{1.3,-0.0,0.3},
-{1.0,0.7,0.5},
-{1.1,0.5,0.5},
-{1.1,0.6,0.3},
-{0.8,0.6,0.8},
-{0.9,0.4,0.9},
-{1.0,0.5,0.7},
-{1.0,0.3,-0.8},
-{1.1,0.3,-0.6},
-{1.2,-0.0,-0.6},
-{0.9,0.7,-0.7},
-{1.0,0.7,-0.5},
-{1.1,0.5,-0.5},
-{1.0,0.8,-0.3},
-{1.0,0.8,0.0},
-{1.2,0.6,0.0},
-{1.0,-0.7,-0.5},
-{0.9,-0.9,-0.4},
-{0.8,-0.8,-0.6},
-{1.1,-0.3,-0.6},
-{1.1,-0.5,-0.5},
-{1.0,-0.5,-0.7},
-{1.3,-0.3,0.0},
-{1.2,-0.6,0.0},
-{1.1,-0.6,-0.3},
-{0.3,-1.1,0.6},
-{-0.0,-1.2,0.6},
-{-0.0,-1.3,0.3},
-{0.7,-1.0,0.5},
-{0.5,-1.1,0.5},
-{0.6,-1.1,0.3},
-{0.6,-0.8,0.8},
-{0.4,-0.9,0.9},
-{0.5,-1.0,0.7},
-{0.3,-1.0,-0.8},
-{0.3,-1.1,-0.6},
-{-0.0,-1.2,-0.6},
-{0.7,-0.9,-0.7},
-{0.7,-1.0,-0.5},
-{0.5,-1.1,-0.5},
-{0.8,-1.0,-0.3},
-{0.8,-1.0,0.0},
-{0.6,-1.2,0.0},
-{-0.7,-1.0,-0.5},
-{-0.9,-0.9,-0.4},
-{-0.8,-0.8,-0.6},
-{-0.3,-1.1,-0.6},
-{-0.5,-1.1,-0.5},
-{-0.5,-1.0,-0.7},
-{-0.3,-1.3,0.0},
-{-0.6,-1.2,0.0},
-{-0.6,-1.1,-0.3},
-{-1.1,-0.3,0.6},
-{-1.2,0.0,0.6},
-{-1.3,0.0,0.3},
-{-1.0,-0.7,0.5},
-{-1.1,-0.5,0.5},
-{-1.1,-0.6,0.3},
-{-0.8,-0.6,0.8},
-{-0.9,-0.4,0.9},
-{-1.0,-0.5,0.7},
-{-1.0,-0.3,-0.8},
-{-1.1,-0.3,-0.6},
-{-1.2,0.0,-0.6},
-{-0.9,-0.7,-0.7},
-{-1.0,-0.7,-0.5},
-{-1.1,-0.5,-0.5},
-{-1.0,-0.8,-0.3},
-{-1.0,-0.8,0.0},
-{-1.2,-0.6,0.0},
-{-1.0,0.7,-0.5},
-{-0.9,0.9,-0.4},
-{-0.8,0.8,-0.6},
-{-1.1,0.3,-0.6},
-{-1.1,0.5,-0.5},
-{-1.0,0.5,-0.7},
-{-1.3,0.3,0.0},
-{-1.2,0.6,0.0},
-{-1.1,0.6,-0.3},
-{0.3,1.1,-0.6},
-{0.0,1.2,-0.6},
-{0.0,1.3,-0.3},
-{0.7,1.0,-0.5},
-{0.5,1.1,-0.5},
-{0.6,1.1,-0.3},
-{0.6,0.8,-0.8},
-{0.4,0.9,-0.9},
-{0.5,1.0,-0.7},
-{0.3,1.0,0.8},
-{0.3,1.1,0.6},
-{0.0,1.2,0.6},
-{0.7,0.9,0.7},
-{0.7,1.0,0.5},
-{0.5,1.1,0.5},
-{0.8,1.0,0.3},
-{0.8,1.0,0.0},
-{0.6,1.2,0.0},
-{-0.7,1.0,0.5},
-{-0.9,0.9,0.4},
-{-0.8,0.8,0.6},
-{-0.3,1.1,0.6},
-{-0.5,1.1,0.5},
-{-0.5,1.0,0.7},
-{-0.3,1.3,0.0},
-{-0.6,1.2,0.0},
-{-0.6,1.1,0.3},
-{-0.8,1.0,-0.3},
-{-0.7,1.0,-0.5},
-{-0.9,0.9,-0.4},
-{-0.3,1.2,-0.3},
-{-0.3,1.1,-0.6},
-{-0.5,1.1,-0.5},
-{-0.3,1.0,-0.8},
-{-0.2,0.9,-0.9},
-{-0.4,0.9,-0.9},
-{-1.0,0.8,0.3},
-{-1.0,0.7,0.5},
-{-0.9,0.9,0.4},
-{-1.2,0.3,0.3},
-{-1.1,0.3,0.6},
-{-1.1,0.5,0.5},
-{-1.0,0.3,0.8},
-{-0.9,0.2,0.9},
-{-0.9,0.4,0.9},
-{-0.8,-1.0,0.3},
-{-0.7,-1.0,0.5},
-{-0.9,-0.9,0.4},
-{-0.3,-1.2,0.3},
-{-0.3,-1.1,0.6},
-{-0.5,-1.1,0.5},
-{-0.3,-1.0,0.8},
-{-0.2,-0.9,0.9},
-{-0.4,-0.9,0.9},
-{1.0,-0.8,0.3},
-{1.0,-0.7,0.5},
-{0.9,-0.9,0.4},
-{1.2,-0.3,0.3},
-{1.1,-0.3,0.6},
-{1.1,-0.5,0.5},
-{1.0,-0.3,0.8},
-{0.9,-0.2,0.9},
-{0.9,-0.4,0.9},
-{-0.3,-0.8,1.0},
-{-0.5,-0.7,1.0},
-{-0.4,-0.9,0.9},
-{-0.3,-0.3,1.2},
-{-0.6,-0.3,1.1},
-{-0.5,-0.5,1.1},
-{-0.8,-0.3,1.0},
-{-0.9,-0.2,0.9},
-{-0.9,-0.4,0.9},
-{-0.8,-0.3,-1.0},
-{-0.7,-0.5,-1.0},
-{-0.9,-0.4,-0.9},
-{-0.3,-0.3,-1.2},
-{-0.3,-0.6,-1.1},
-{-0.5,-0.5,-1.1},
-{-0.3,-0.8,-1.0},
-{-0.2,-0.9,-0.9},
-{-0.4,-0.9,-0.9},
-{-0.3,-0.6,-1.1},
-{-0.3,-0.8,-1.0},
-{-0.5,-0.7,-1.0},
-{0.0,-0.6,-1.2},
-{0.0,-0.8,-1.0},
-{-0.3,-0.8,-1.0},
-{0.0,-0.8,-1.0},
-{-0.0,-0.9,-0.9},
-{-0.2,-0.9,-0.9},
-{-0.3,0.0,-1.3},
-{-0.3,-0.3,-1.2},
-{-0.6,-0.3,-1.1},
-{0.0,0.0,-1.3},
-{0.0,-0.3,-1.3},
-{-0.3,-0.3,-1.2},
-{0.0,-0.3,-1.3},
-{0.0,-0.6,-1.2},
-{-0.3,-0.6,-1.1},
-{-0.8,0.0,-1.0},
-{-0.8,-0.3,-1.0},
-{-0.9,-0.2,-0.9},
-{-0.6,0.0,-1.2},
-{-0.6,-0.3,-1.1},
-{-0.8,-0.3,-1.0},
-{-0.6,-0.3,-1.1},
-{-0.5,-0.5,-1.1},
-{-0.7,-0.5,-1.0},
-{-0.6,-0.3,1.1},
-{-0.8,-0.3,1.0},
-{-0.7,-0.5,1.0},
-{-0.6,0.0,1.2},
-{-0.8,0.0,1.0},
-{-0.8,-0.3,1.0},
-{-0.8,0.0,1.0},
-{-0.9,0.0,0.9},
-{-0.9,-0.2,0.9},
-{-0.0,-0.3,1.3},
-{-0.3,-0.3,1.2},
-{-0.3,-0.6,1.1},
-{-0.0,-0.0,1.3},
-{-0.3,-0.0,1.3},
-{-0.3,-0.3,1.2},
-{-0.3,-0.0,1.3},
-{-0.6,0.0,1.2},
-{-0.6,-0.3,1.1},
-{-0.0,-0.8,1.0},
-{-0.3,-0.8,1.0},
-{-0.2,-0.9,0.9},
-{-0.0,-0.6,1.2},
-{-0.3,-0.6,1.1},
-{-0.3,-0.8,1.0},
-{-0.3,-0.6,1.1},
-{-0.5,-0.5,1.1},
-{-0.5,-0.7,1.0},
-{1.1,-0.3,0.6},
-{1.0,-0.3,0.8},
-{1.0,-0.5,0.7},
-{1.2,-0.0,0.6},
-{1.0,-0.0,0.8},
-{1.0,-0.3,0.8},
-{1.0,-0.0,0.8},
-{0.9,-0.0,0.9},
-{0.9,-0.2,0.9},
-{1.3,-0.3,0.0},
-{1.2,-0.3,0.3},
-{1.1,-0.6,0.3},
-{1.3,-0.0,0.0},
-{1.3,-0.0,0.3},
-{1.2,-0.3,0.3},
-{1.3,-0.0,0.3},
-{1.2,-0.0,0.6},
-{1.1,-0.3,0.6},
-{1.0,-0.8,0.0},
-{1.0,-0.8,0.3},
-{0.9,-0.9,0.2},
-{1.2,-0.6,0.0},
-{1.1,-0.6,0.3},
-{1.0,-0.8,0.3},
-{1.1,-0.6,0.3},
-{1.1,-0.5,0.5},
-{1.0,-0.7,0.5},
-{-0.3,-1.1,0.6},
-{-0.3,-1.0,0.8},
-{-0.5,-1.0,0.7},
-{-0.0,-1.2,0.6},
-{-0.0,-1.0,0.8},
-{-0.3,-1.0,0.8},
-{-0.0,-1.0,0.8},
-{-0.0,-0.9,0.9},
-{-0.2,-0.9,0.9},
-{-0.3,-1.3,0.0},
-{-0.3,-1.2,0.3},
-{-0.6,-1.1,0.3},
-{-0.0,-1.3,0.0},
-{-0.0,-1.3,0.3},
-{-0.3,-1.2,0.3},
-{-0.0,-1.3,0.3},
-{-0.0,-1.2,0.6},
-{-0.3,-1.1,0.6},
-{-0.8,-1.0,0.0},
-{-0.8,-1.0,0.3},
-{-0.9,-0.9,0.2},
-{-0.6,-1.2,0.0},
-{-0.6,-1.1,0.3},
-{-0.8,-1.0,0.3},
-{-0.6,-1.1,0.3},
-{-0.5,-1.1,0.5},
-{-0.7,-1.0,0.5},
-{-1.1,0.3,0.6},
-{-1.0,0.3,0.8},
-{-1.0,0.5,0.7},
-{-1.2,0.0,0.6},
-{-1.0,0.0,0.8},
-{-1.0,0.3,0.8},
-{-1.0,0.0,0.8},
-{-0.9,0.0,0.9},
-{-0.9,0.2,0.9},
-{-1.3,0.3,0.0},
-{-1.2,0.3,0.3},
-{-1.1,0.6,0.3},
-{-1.3,0.0,0.0},
-{-1.3,0.0,0.3},
-{-1.2,0.3,0.3},
-{-1.3,0.0,0.3},
-{-1.2,0.0,0.6},
-{-1.1,0.3,0.6},
-{-1.0,0.8,0.0},
-{-1.0,0.8,0.3},
-{-0.9,0.9,0.2},
-{-1.2,0.6,0.0},
-{-1.1,0.6,0.3},
-{-1.0,0.8,0.3},
-{-1.1,0.6,0.3},
-{-1.1,0.5,0.5},
-{-1.0,0.7,0.5},
-{-0.3,1.1,-0.6},
-{-0.3,1.0,-0.8},
-{-0.5,1.0,-0.7},
-{0.0,1.2,-0.6},
-{0.0,1.0,-0.8},
-{-0.3,1.0,-0.8},
-{0.0,1.0,-0.8},
-{0.0,0.9,-0.9},
-{-0.2,0.9,-0.9},
-{-0.3,1.3,0.0},
-{-0.3,1.2,-0.3},
-{-0.6,1.1,-0.3},
-{0.0,1.3,0.0},
-{0.0,1.3,-0.3},
-{-0.3,1.2,-0.3},
-{0.0,1.3,-0.3},
-{0.0,1.2,-0.6},
-{-0.3,1.1,-0.6},
-{-0.8,1.0,0.0},
-{-0.8,1.0,-0.3},
-{-0.9,0.9,-0.2},
-{-0.6,1.2,0.0},
-{-0.6,1.1,-0.3},
-{-0.8,1.0,-0.3},
-{-0.6,1.1,-0.3},
-{-0.5,1.1,-0.5},
-{-0.7,1.0,-0.5},
-{-0.3,1.2,0.3},
-{-0.6,1.1,0.3},
-{-0.5,1.1,0.5},
-{0.0,1.3,0.3},
-{-0.3,1.2,0.3},
-{-0.3,1.1,0.6},
-{0.0,1.3,0.0},
-{-0.3,1.3,0.0},
-{-0.3,1.2,0.3},
-{-0.3,1.0,0.8},
-{-0.5,1.0,0.7},
-{-0.4,0.9,0.9},
-{0.0,1.0,0.8},
-{-0.3,1.0,0.8},
-{-0.2,0.9,0.9},
-{0.0,1.2,0.6},
-{-0.3,1.1,0.6},
-{-0.3,1.0,0.8},
-{-0.7,0.9,0.7},
-{-0.8,0.8,0.6},
-{-0.7,0.7,0.7},
-{-0.5,1.0,0.7},
-{-0.7,0.9,0.7},
-{-0.6,0.8,0.8},
-{-0.5,1.1,0.5},
-{-0.7,1.0,0.5},
-{-0.7,0.9,0.7},
-{0.7,1.0,0.5},
-{0.8,1.0,0.3},
-{0.6,1.1,0.3},
-{0.9,0.9,0.4},
-{0.9,0.9,0.2},
-{0.8,1.0,0.3},
-{0.9,0.9,0.2},
-{0.9,0.9,-0.0},
-{0.8,1.0,0.0},
-{0.6,0.8,0.8},
-{0.7,0.9,0.7},
-{0.5,1.0,0.7},
-{0.7,0.7,0.7},
-{0.8,0.8,0.6},
-{0.7,0.9,0.7},
-{0.8,0.8,0.6},
-{0.9,0.9,0.4},
-{0.7,1.0,0.5},
-{0.2,0.9,0.9},
-{0.3,1.0,0.8},
-{0.0,1.0,0.8},
-{0.4,0.9,0.9},
-{0.5,1.0,0.7},
-{0.3,1.0,0.8},
-{0.5,1.0,0.7},
-{0.5,1.1,0.5},
-{0.3,1.1,0.6},
-{0.7,0.9,-0.7},
-{0.5,1.0,-0.7},
-{0.5,1.1,-0.5},
-{0.8,0.8,-0.6},
-{0.7,0.9,-0.7},
-{0.7,1.0,-0.5},
-{0.7,0.7,-0.7},
-{0.6,0.8,-0.8},
-{0.7,0.9,-0.7},
-{0.8,1.0,-0.3},
-{0.6,1.1,-0.3},
-{0.6,1.2,0.0},
-{0.9,0.9,-0.2},
-{0.8,1.0,-0.3},
-{0.8,1.0,0.0},
-{0.9,0.9,-0.4},
-{0.7,1.0,-0.5},
-{0.8,1.0,-0.3},
-{0.3,1.2,-0.3},
-{0.0,1.3,-0.3},
-{0.0,1.3,0.0},
-{0.6,1.1,-0.3},
-{0.3,1.2,-0.3},
-{0.3,1.3,0.0},
-{0.5,1.1,-0.5},
-{0.3,1.1,-0.6},
-{0.3,1.2,-0.3},
-{-1.2,0.3,-0.3},
-{-1.1,0.6,-0.3},
-{-1.1,0.5,-0.5},
-{-1.3,0.0,-0.3},
-{-1.2,0.3,-0.3},
-{-1.1,0.3,-0.6},
-{-1.3,0.0,0.0},
-{-1.3,0.3,0.0},
-{-1.2,0.3,-0.3},
-{-1.0,0.3,-0.8},
-{-1.0,0.5,-0.7},
-{-0.9,0.4,-0.9},
-{-1.0,0.0,-0.8},
-{-1.0,0.3,-0.8},
-{-0.9,0.2,-0.9},
-{-1.2,0.0,-0.6},
-{-1.1,0.3,-0.6},
-{-1.0,0.3,-0.8},
-{-0.9,0.7,-0.7},
-{-0.8,0.8,-0.6},
-{-0.7,0.7,-0.7},
-{-1.0,0.5,-0.7},
-{-0.9,0.7,-0.7},
-{-0.8,0.6,-0.8},
-{-1.1,0.5,-0.5},
-{-1.0,0.7,-0.5},
-{-0.9,0.7,-0.7},
-{-1.0,-0.7,-0.5},
-{-1.0,-0.8,-0.3},
-{-1.1,-0.6,-0.3},
-{-0.9,-0.9,-0.4},
-{-0.9,-0.9,-0.2},
-{-1.0,-0.8,-0.3},
-{-0.9,-0.9,-0.2},
-{-0.9,-0.9,-0.0},
-{-1.0,-0.8,0.0},
-{-0.8,-0.6,-0.8},
-{-0.9,-0.7,-0.7},
-{-1.0,-0.5,-0.7},
-{-0.7,-0.7,-0.7},
-{-0.8,-0.8,-0.6},
-{-0.9,-0.7,-0.7},
-{-0.8,-0.8,-0.6},
-{-0.9,-0.9,-0.4},
-{-1.0,-0.7,-0.5},
-{-0.9,-0.2,-0.9},
-{-1.0,-0.3,-0.8},
-{-1.0,0.0,-0.8},
-{-0.9,-0.4,-0.9},
-{-1.0,-0.5,-0.7},
-{-1.0,-0.3,-0.8},
-{-1.0,-0.5,-0.7},
-{-1.1,-0.5,-0.5},
-{-1.1,-0.3,-0.6},
-{-0.9,-0.7,0.7},
-{-1.0,-0.5,0.7},
-{-1.1,-0.5,0.5},
-{-0.8,-0.8,0.6},
-{-0.9,-0.7,0.7},
-{-1.0,-0.7,0.5},
-{-0.7,-0.7,0.7},
-{-0.8,-0.6,0.8},
-{-0.9,-0.7,0.7},
-{-1.0,-0.8,0.3},
-{-1.1,-0.6,0.3},
-{-1.2,-0.6,0.0},
-{-0.9,-0.9,0.2},
-{-1.0,-0.8,0.3},
-{-1.0,-0.8,0.0},
-{-0.9,-0.9,0.4},
-{-1.0,-0.7,0.5},
-{-1.0,-0.8,0.3},
-{-1.2,-0.3,0.3},
-{-1.3,0.0,0.3},
-{-1.3,0.0,0.0},
-{-1.1,-0.6,0.3},
-{-1.2,-0.3,0.3},
-{-1.3,-0.3,0.0},
-{-1.1,-0.5,0.5},
-{-1.1,-0.3,0.6},
-{-1.2,-0.3,0.3},
-{-0.3,-1.2,-0.3},
-{-0.6,-1.1,-0.3},
-{-0.5,-1.1,-0.5},
-{-0.0,-1.3,-0.3},
-{-0.3,-1.2,-0.3},
-{-0.3,-1.1,-0.6},
-{-0.0,-1.3,0.0},
-{-0.3,-1.3,0.0},
-{-0.3,-1.2,-0.3},
-{-0.3,-1.0,-0.8},
-{-0.5,-1.0,-0.7},
-{-0.4,-0.9,-0.9},
-{-0.0,-1.0,-0.8},
-{-0.3,-1.0,-0.8},
-{-0.2,-0.9,-0.9},
-{-0.0,-1.2,-0.6},
-{-0.3,-1.1,-0.6},
-{-0.3,-1.0,-0.8},
-{-0.7,-0.9,-0.7},
-{-0.8,-0.8,-0.6},
-{-0.7,-0.7,-0.7},
-{-0.5,-1.0,-0.7},
-{-0.7,-0.9,-0.7},
-{-0.6,-0.8,-0.8},
-{-0.5,-1.1,-0.5},
-{-0.7,-1.0,-0.5},
-{-0.7,-0.9,-0.7},
-{0.7,-1.0,-0.5},
-{0.8,-1.0,-0.3},
-{0.6,-1.1,-0.3},
-{0.9,-0.9,-0.4},
-{0.9,-0.9,-0.2},
-{0.8,-1.0,-0.3},
-{0.9,-0.9,-0.2},
-{0.9,-0.9,-0.0},
-{0.8,-1.0,0.0},
-{0.6,-0.8,-0.8},
-{0.7,-0.9,-0.7},
-{0.5,-1.0,-0.7},
-{0.7,-0.7,-0.7},
-{0.8,-0.8,-0.6},
-{0.7,-0.9,-0.7},
-{0.8,-0.8,-0.6},
-{0.9,-0.9,-0.4},
-{0.7,-1.0,-0.5},
-{0.2,-0.9,-0.9},
-{0.3,-1.0,-0.8},
-{-0.0,-1.0,-0.8},
-{0.4,-0.9,-0.9},
-{0.5,-1.0,-0.7},
-{0.3,-1.0,-0.8},
-{0.5,-1.0,-0.7},
-{0.5,-1.1,-0.5},
-{0.3,-1.1,-0.6},
-{0.7,-0.9,0.7},
-{0.5,-1.0,0.7},
-{0.5,-1.1,0.5},
-{0.8,-0.8,0.6},
-{0.7,-0.9,0.7},
-{0.7,-1.0,0.5},
-{0.7,-0.7,0.7},
-{0.6,-0.8,0.8},
-{0.7,-0.9,0.7},
-{0.8,-1.0,0.3},
-{0.6,-1.1,0.3},
-{0.6,-1.2,0.0},
-{0.9,-0.9,0.2},
-{0.8,-1.0,0.3},
-{0.8,-1.0,0.0},
-{0.9,-0.9,0.4},
-{0.7,-1.0,0.5},
-{0.8,-1.0,0.3},
-{0.3,-1.2,0.3},
-{-0.0,-1.3,0.3},
-{-0.0,-1.3,0.0},
-{0.6,-1.1,0.3},
-{0.3,-1.2,0.3},
-{0.3,-1.3,0.0},
-{0.5,-1.1,0.5},
-{0.3,-1.1,0.6},
-{0.3,-1.2,0.3},
-{1.2,-0.3,-0.3},
-{1.1,-0.6,-0.3},
-{1.1,-0.5,-0.5},
-{1.3,-0.0,-0.3},
-{1.2,-0.3,-0.3},
-{1.1,-0.3,-0.6},
-{1.3,-0.0,0.0},
-{1.3,-0.3,0.0},
-{1.2,-0.3,-0.3},
-{1.0,-0.3,-0.8},
-{1.0,-0.5,-0.7},
-{0.9,-0.4,-0.9},
-{1.0,-0.0,-0.8},
-{1.0,-0.3,-0.8},
-{0.9,-0.2,-0.9},
-{1.2,-0.0,-0.6},
-{1.1,-0.3,-0.6},
-{1.0,-0.3,-0.8},
-{0.9,-0.7,-0.7},
-{0.8,-0.8,-0.6},
-{0.7,-0.7,-0.7},
-{1.0,-0.5,-0.7},
-{0.9,-0.7,-0.7},
-{0.8,-0.6,-0.8},
-{1.1,-0.5,-0.5},
-{1.0,-0.7,-0.5},
-{0.9,-0.7,-0.7},
-{1.0,0.7,-0.5},
-{1.0,0.8,-0.3},
-{1.1,0.6,-0.3},
-{0.9,0.9,-0.4},
-{0.9,0.9,-0.2},
-{1.0,0.8,-0.3},
-{0.9,0.9,-0.2},
-{0.9,0.9,-0.0},
-{1.0,0.8,0.0},
-{0.8,0.6,-0.8},
-{0.9,0.7,-0.7},
-{1.0,0.5,-0.7},
-{0.7,0.7,-0.7},
-{0.8,0.8,-0.6},
-{0.9,0.7,-0.7},
-{0.8,0.8,-0.6},
-{0.9,0.9,-0.4},
-{1.0,0.7,-0.5},
-{0.9,0.2,-0.9},
-{1.0,0.3,-0.8},
-{1.0,-0.0,-0.8},
-{0.9,0.4,-0.9},
-{1.0,0.5,-0.7},
-{1.0,0.3,-0.8},
-{1.0,0.5,-0.7},
-{1.1,0.5,-0.5},
-{1.1,0.3,-0.6},
-{0.9,0.7,0.7},
-{1.0,0.5,0.7},
-{1.1,0.5,0.5},
-{0.8,0.8,0.6},
-{0.9,0.7,0.7},
-{1.0,0.7,0.5},
-{0.7,0.7,0.7},
-{0.8,0.6,0.8},
-{0.9,0.7,0.7},
-{1.0,0.8,0.3},
-{1.1,0.6,0.3},
-{1.2,0.6,0.0},
-{0.9,0.9,0.2},
-{1.0,0.8,0.3},
-{1.0,0.8,0.0},
-{0.9,0.9,0.4},
-{1.0,0.7,0.5},
-{1.0,0.8,0.3},
-{1.2,0.3,0.3},
-{1.3,-0.0,0.3},
-{1.3,-0.0,0.0},
-{1.1,0.6,0.3},
-{1.2,0.3,0.3},
-{1.3,0.3,0.0},
-{1.1,0.5,0.5},
-{1.1,0.3,0.6},
-{1.2,0.3,0.3},
-{0.3,-0.3,1.2},
-{0.3,-0.6,1.1},
-{0.5,-0.5,1.1},
-{0.3,-0.0,1.3},
-{0.3,-0.3,1.2},
-{0.6,-0.3,1.1},
-{-0.0,-0.0,1.3},
-{-0.0,-0.3,1.3},
-{0.3,-0.3,1.2},
-{0.8,-0.3,1.0},
-{0.7,-0.5,1.0},
-{0.9,-0.4,0.9},
-{0.8,-0.0,1.0},
-{0.8,-0.3,1.0},
-{0.9,-0.2,0.9},
-{0.6,-0.0,1.2},
-{0.6,-0.3,1.1},
-{0.8,-0.3,1.0},
-{0.7,-0.7,0.9},
-{0.6,-0.8,0.8},
-{0.7,-0.7,0.7},
-{0.7,-0.5,1.0},
-{0.7,-0.7,0.9},
-{0.8,-0.6,0.8},
-{0.5,-0.5,1.1},
-{0.5,-0.7,1.0},
-{0.7,-0.7,0.9},
-{0.5,0.7,1.0},
-{0.3,0.8,1.0},
-{0.3,0.6,1.1},
-{0.4,0.9,0.9},
-{0.2,0.9,0.9},
-{0.3,0.8,1.0},
-{0.2,0.9,0.9},
-{0.0,0.9,0.9},
-{0.0,0.8,1.0},
-{0.8,0.6,0.8},
-{0.7,0.7,0.9},
-{0.7,0.5,1.0},
-{0.7,0.7,0.7},
-{0.6,0.8,0.8},
-{0.7,0.7,0.9},
-{0.6,0.8,0.8},
-{0.4,0.9,0.9},
-{0.5,0.7,1.0},
-{0.9,0.2,0.9},
-{0.8,0.3,1.0},
-{0.8,-0.0,1.0},
-{0.9,0.4,0.9},
-{0.7,0.5,1.0},
-{0.8,0.3,1.0},
-{0.7,0.5,1.0},
-{0.5,0.5,1.1},
-{0.6,0.3,1.1},
-{-0.7,0.7,0.9},
-{-0.7,0.5,1.0},
-{-0.5,0.5,1.1},
-{-0.6,0.8,0.8},
-{-0.7,0.7,0.9},
-{-0.5,0.7,1.0},
-{-0.7,0.7,0.7},
-{-0.8,0.6,0.8},
-{-0.7,0.7,0.9},
-{-0.3,0.8,1.0},
-{-0.3,0.6,1.1},
-{0.0,0.6,1.2},
-{-0.2,0.9,0.9},
-{-0.3,0.8,1.0},
-{0.0,0.8,1.0},
-{-0.4,0.9,0.9},
-{-0.5,0.7,1.0},
-{-0.3,0.8,1.0},
-{-0.3,0.3,1.2},
-{-0.3,-0.0,1.3},
-{-0.0,-0.0,1.3},
-{-0.3,0.6,1.1},
-{-0.3,0.3,1.2},
-{-0.0,0.3,1.3},
-{-0.5,0.5,1.1},
-{-0.6,0.3,1.1},
-{-0.3,0.3,1.2},
-{-0.3,0.3,-1.2},
-{-0.6,0.3,-1.1},
-{-0.5,0.5,-1.1},
-{0.0,0.3,-1.3},
-{-0.3,0.3,-1.2},
-{-0.3,0.6,-1.1},
-{0.0,0.0,-1.3},
-{-0.3,0.0,-1.3},
-{-0.3,0.3,-1.2},
-{-0.3,0.8,-1.0},
-{-0.5,0.7,-1.0},
-{-0.4,0.9,-0.9},
-{0.0,0.8,-1.0},
-{-0.3,0.8,-1.0},
-{-0.2,0.9,-0.9},
-{0.0,0.6,-1.2},
-{-0.3,0.6,-1.1},
-{-0.3,0.8,-1.0},
-{-0.7,0.7,-0.9},
-{-0.8,0.6,-0.8},
-{-0.7,0.7,-0.7},
-{-0.5,0.7,-1.0},
-{-0.7,0.7,-0.9},
-{-0.6,0.8,-0.8},
-{-0.5,0.5,-1.1},
-{-0.7,0.5,-1.0},
-{-0.7,0.7,-0.9},
-{0.7,0.5,-1.0},
-{0.8,0.3,-1.0},
-{0.6,0.3,-1.1},
-{0.9,0.4,-0.9},
-{0.9,0.2,-0.9},
-{0.8,0.3,-1.0},
-{0.9,0.2,-0.9},
-{0.9,-0.0,-0.9},
-{0.8,-0.0,-1.0},
-{0.6,0.8,-0.8},
-{0.7,0.7,-0.9},
-{0.5,0.7,-1.0},
-{0.7,0.7,-0.7},
-{0.8,0.6,-0.8},
-{0.7,0.7,-0.9},
-{0.8,0.6,-0.8},
-{0.9,0.4,-0.9},
-{0.7,0.5,-1.0},
-{0.2,0.9,-0.9},
-{0.3,0.8,-1.0},
-{0.0,0.8,-1.0},
-{0.4,0.9,-0.9},
-{0.5,0.7,-1.0},
-{0.3,0.8,-1.0},
-{0.5,0.7,-1.0},
-{0.5,0.5,-1.1},
-{0.3,0.6,-1.1},
-{0.7,-0.7,-0.9},
-{0.5,-0.7,-1.0},
-{0.5,-0.5,-1.1},
-{0.8,-0.6,-0.8},
-{0.7,-0.7,-0.9},
-{0.7,-0.5,-1.0},
-{0.7,-0.7,-0.7},
-{0.6,-0.8,-0.8},
-{0.7,-0.7,-0.9},
-{0.8,-0.3,-1.0},
-{0.6,-0.3,-1.1},
-{0.6,0.0,-1.2},
-{0.9,-0.2,-0.9},
-{0.8,-0.3,-1.0},
-{0.8,-0.0,-1.0},
-{0.9,-0.4,-0.9},
-{0.7,-0.5,-1.0},
-{0.8,-0.3,-1.0},
-{0.3,-0.3,-1.2},
-{0.0,-0.3,-1.3},
-{0.0,0.0,-1.3},
-{0.6,-0.3,-1.1},
-{0.3,-0.3,-1.2},
-{0.3,0.0,-1.3},
-{0.5,-0.5,-1.1},
-{0.3,-0.6,-1.1},
-{0.3,-0.3,-1.2},
-{0.3,-0.8,-1.0},
-{0.0,-0.8,-1.0},
-{0.0,-0.6,-1.2},
-{0.5,-0.7,-1.0},
-{0.3,-0.8,-1.0},
-{0.3,-0.6,-1.1},
-{0.4,-0.9,-0.9},
-{0.2,-0.9,-0.9},
-{0.3,-0.8,-1.0},
-{0.3,0.6,-1.1},
-{0.3,0.3,-1.2},
-{0.0,0.3,-1.3},
-{0.5,0.5,-1.1},
-{0.6,0.3,-1.1},
-{0.3,0.3,-1.2},
-{0.6,0.3,-1.1},
-{0.6,0.0,-1.2},
-{0.3,0.0,-1.3},
-{-0.8,0.3,-1.0},
-{-0.9,0.2,-0.9},
-{-0.9,0.4,-0.9},
-{-0.6,0.3,-1.1},
-{-0.8,0.3,-1.0},
-{-0.7,0.5,-1.0},
-{-0.6,0.0,-1.2},
-{-0.8,0.0,-1.0},
-{-0.8,0.3,-1.0},
-{-0.8,0.3,1.0},
-{-0.8,0.0,1.0},
-{-0.6,0.0,1.2},
-{-0.7,0.5,1.0},
-{-0.8,0.3,1.0},
-{-0.6,0.3,1.1},
-{-0.9,0.4,0.9},
-{-0.9,0.2,0.9},
-{-0.8,0.3,1.0},
-{0.6,0.3,1.1},
-{0.3,0.3,1.2},
-{0.3,-0.0,1.3},
-{0.5,0.5,1.1},
-{0.3,0.6,1.1},
-{0.3,0.3,1.2},
-{0.3,0.6,1.1},
-{0.0,0.6,1.2},
-{-0.0,0.3,1.3},
-{0.3,-0.8,1.0},
-{0.2,-0.9,0.9},
-{0.4,-0.9,0.9},
-{0.3,-0.6,1.1},
-{0.3,-0.8,1.0},
-{0.5,-0.7,1.0},
-{-0.0,-0.6,1.2},
-{-0.0,-0.8,1.0},
-{0.3,-0.8,1.0},
-{1.0,0.3,0.8},
-{1.0,-0.0,0.8},
-{1.2,-0.0,0.6},
-{1.0,0.5,0.7},
-{1.0,0.3,0.8},
-{1.1,0.3,0.6},
-{0.9,0.4,0.9},
-{0.9,0.2,0.9},
-{1.0,0.3,0.8},
-{1.1,0.3,-0.6},
-{1.2,0.3,-0.3},
-{1.3,-0.0,-0.3},
-{1.1,0.5,-0.5},
-{1.1,0.6,-0.3},
-{1.2,0.3,-0.3},
-{1.1,0.6,-0.3},
-{1.2,0.6,0.0},
-{1.3,0.3,0.0},
-{1.0,-0.8,-0.3},
-{0.9,-0.9,-0.2},
-{0.9,-0.9,-0.4},
-{1.1,-0.6,-0.3},
-{1.0,-0.8,-0.3},
-{1.0,-0.7,-0.5},
-{1.2,-0.6,0.0},
-{1.0,-0.8,0.0},
-{1.0,-0.8,-0.3},
-{0.3,-1.0,0.8},
-{-0.0,-1.0,0.8},
-{-0.0,-1.2,0.6},
-{0.5,-1.0,0.7},
-{0.3,-1.0,0.8},
-{0.3,-1.1,0.6},
-{0.4,-0.9,0.9},
-{0.2,-0.9,0.9},
-{0.3,-1.0,0.8},
-{0.3,-1.1,-0.6},
-{0.3,-1.2,-0.3},
-{-0.0,-1.3,-0.3},
-{0.5,-1.1,-0.5},
-{0.6,-1.1,-0.3},
-{0.3,-1.2,-0.3},
-{0.6,-1.1,-0.3},
-{0.6,-1.2,0.0},
-{0.3,-1.3,0.0},
-{-0.8,-1.0,-0.3},
-{-0.9,-0.9,-0.2},
-{-0.9,-0.9,-0.4},
-{-0.6,-1.1,-0.3},
-{-0.8,-1.0,-0.3},
-{-0.7,-1.0,-0.5},
-{-0.6,-1.2,0.0},
-{-0.8,-1.0,0.0},
-{-0.8,-1.0,-0.3},
-{-1.0,-0.3,0.8},
-{-1.0,0.0,0.8},
-{-1.2,0.0,0.6},
-{-1.0,-0.5,0.7},
-{-1.0,-0.3,0.8},
-{-1.1,-0.3,0.6},
-{-0.9,-0.4,0.9},
-{-0.9,-0.2,0.9},
-{-1.0,-0.3,0.8},
-{-1.1,-0.3,-0.6},
-{-1.2,-0.3,-0.3},
-{-1.3,0.0,-0.3},
-{-1.1,-0.5,-0.5},
-{-1.1,-0.6,-0.3},
-{-1.2,-0.3,-0.3},
-{-1.1,-0.6,-0.3},
-{-1.2,-0.6,0.0},
-{-1.3,-0.3,0.0},
-{-1.0,0.8,-0.3},
-{-0.9,0.9,-0.2},
-{-0.9,0.9,-0.4},
-{-1.1,0.6,-0.3},
-{-1.0,0.8,-0.3},
-{-1.0,0.7,-0.5},
-{-1.2,0.6,0.0},
-{-1.0,0.8,0.0},
-{-1.0,0.8,-0.3},
-{0.3,1.0,-0.8},
-{0.0,1.0,-0.8},
-{0.0,1.2,-0.6},
-{0.5,1.0,-0.7},
-{0.3,1.0,-0.8},
-{0.3,1.1,-0.6},
-{0.4,0.9,-0.9},
-{0.2,0.9,-0.9},
-{0.3,1.0,-0.8},
-{0.3,1.1,0.6},
-{0.3,1.2,0.3},
-{0.0,1.3,0.3},
-{0.5,1.1,0.5},
-{0.6,1.1,0.3},
-{0.3,1.2,0.3},
-{0.6,1.1,0.3},
-{0.6,1.2,0.0},
-{0.3,1.3,0.0},
-{-0.8,1.0,0.3},
-{-0.9,0.9,0.2},
-{-0.9,0.9,0.4},
-{-0.6,1.1,0.3},
-{-0.8,1.0,0.3},
-{-0.7,1.0,0.5},
-{-0.6,1.2,0.0},
-{-0.8,1.0,0.0},
-{-0.8,1.0,0.3},
-{-0.7,1.0,-0.5},
-{-0.7,0.9,-0.7},
-{-0.8,0.8,-0.6},
-{-0.5,1.1,-0.5},
-{-0.5,1.0,-0.7},
-{-0.7,0.9,-0.7},
-{-0.5,1.0,-0.7},
-{-0.4,0.9,-0.9},
-{-0.6,0.8,-0.8},
-{-1.0,0.7,0.5},
-{-0.9,0.7,0.7},
-{-0.8,0.8,0.6},
-{-1.1,0.5,0.5},
-{-1.0,0.5,0.7},
-{-0.9,0.7,0.7},
-{-1.0,0.5,0.7},
-{-0.9,0.4,0.9},
-{-0.8,0.6,0.8},
-{-0.7,-1.0,0.5},
-{-0.7,-0.9,0.7},
-{-0.8,-0.8,0.6},
-{-0.5,-1.1,0.5},
-{-0.5,-1.0,0.7},
-{-0.7,-0.9,0.7},
-{-0.5,-1.0,0.7},
-{-0.4,-0.9,0.9},
-{-0.6,-0.8,0.8},
-{1.0,-0.7,0.5},
-{0.9,-0.7,0.7},
-{0.8,-0.8,0.6},
-{1.1,-0.5,0.5},
-{1.0,-0.5,0.7},
-{0.9,-0.7,0.7},
-{1.0,-0.5,0.7},
-{0.9,-0.4,0.9},
-{0.8,-0.6,0.8},
-{-0.5,-0.7,1.0},
-{-0.7,-0.7,0.9},
-{-0.6,-0.8,0.8},
-{-0.5,-0.5,1.1},
-{-0.7,-0.5,1.0},
-{-0.7,-0.7,0.9},
-{-0.7,-0.5,1.0},
-{-0.9,-0.4,0.9},
-{-0.8,-0.6,0.8},
-{-0.7,-0.5,-1.0},
-{-0.7,-0.7,-0.9},
-{-0.8,-0.6,-0.8},
-{-0.5,-0.5,-1.1},
-{-0.5,-0.7,-1.0},
-{-0.7,-0.7,-0.9},
-{-0.5,-0.7,-1.0},
-{-0.4,-0.9,-0.9},
-{-0.6,-0.8,-0.8},
-{-0.8,-0.6,-0.8},
-{-0.7,-0.7,-0.9},
-{-0.7,-0.7,-0.7},
-{-0.6,-0.8,0.8},
-{-0.7,-0.7,0.9},
-{-0.7,-0.7,0.7},
-{0.8,-0.8,0.6},
-{0.9,-0.7,0.7},
-{0.7,-0.7,0.7},
-{-0.8,-0.8,0.6},
-{-0.7,-0.9,0.7},
-{-0.7,-0.7,0.7},
-{-0.8,0.8,0.6},
-{-0.9,0.7,0.7},
-{-0.7,0.7,0.7},
-{-0.8,0.8,-0.6},
-{-0.7,0.9,-0.7},
-{-0.7,0.7,-0.7},
-{-0.8,1.0,0.3},
-{-0.8,1.0,0.0},
-{-0.9,0.9,0.2},
-{0.0,1.3,0.3},
-{0.3,1.2,0.3},
-{0.0,1.3,0.0},
-{0.3,1.0,-0.8},
-{0.2,0.9,-0.9},
-{0.0,1.0,-0.8},
-{-1.0,0.8,-0.3},
-{-1.0,0.8,0.0},
-{-0.9,0.9,-0.2},
-{-1.3,0.0,-0.3},
-{-1.2,-0.3,-0.3},
-{-1.3,0.0,0.0},
-{-1.0,-0.3,0.8},
-{-0.9,-0.2,0.9},
-{-1.0,0.0,0.8},
-{-0.8,-1.0,-0.3},
-{-0.8,-1.0,0.0},
-{-0.9,-0.9,-0.2},
-{-0.0,-1.3,-0.3},
-{0.3,-1.2,-0.3},
-{-0.0,-1.3,0.0},
-{0.3,-1.0,0.8},
-{0.2,-0.9,0.9},
-{-0.0,-1.0,0.8},
-{1.0,-0.8,-0.3},
-{1.0,-0.8,0.0},
-{0.9,-0.9,-0.2},
-{1.3,-0.0,-0.3},
-{1.2,0.3,-0.3},
-{1.3,-0.0,0.0},
-{1.0,0.3,0.8},
-{0.9,0.2,0.9},
-{1.0,-0.0,0.8},
-{0.3,-0.8,1.0},
-{-0.0,-0.8,1.0},
-{0.2,-0.9,0.9},
-{0.3,-0.0,1.3},
-{0.3,0.3,1.2},
-{-0.0,-0.0,1.3},
-{-0.8,0.3,1.0},
-{-0.9,0.2,0.9},
-{-0.8,0.0,1.0},
-{-0.8,0.3,-1.0},
-{-0.8,0.0,-1.0},
-{-0.9,0.2,-0.9},
-{0.0,0.3,-1.3},
-{0.3,0.3,-1.2},
-{0.0,0.0,-1.3},
-{0.3,-0.8,-1.0},
-{0.2,-0.9,-0.9},
-{0.0,-0.8,-1.0},
-{0.3,-0.3,-1.2},
-{0.3,-0.6,-1.1},
-{0.0,-0.3,-1.3},
-{0.8,-0.3,-1.0},
-{0.7,-0.5,-1.0},
-{0.6,-0.3,-1.1},
-{0.7,-0.7,-0.9},
-{0.6,-0.8,-0.8},
-{0.5,-0.7,-1.0},
-{0.0,0.8,-1.0},
-{0.3,0.8,-1.0},
-{0.0,0.6,-1.2},
-{0.5,0.7,-1.0},
-{0.7,0.7,-0.9},
-{0.5,0.5,-1.1},
-{0.6,0.3,-1.1},
-{0.8,0.3,-1.0},
-{0.6,0.0,-1.2},
-{-0.7,0.7,-0.9},
-{-0.7,0.5,-1.0},
-{-0.8,0.6,-0.8},
-{-0.3,0.8,-1.0},
-{-0.3,0.6,-1.1},
-{-0.5,0.7,-1.0},
-{-0.3,0.3,-1.2},
-{-0.3,0.0,-1.3},
-{-0.6,0.3,-1.1},
-{-0.3,0.3,1.2},
-{-0.6,0.3,1.1},
-{-0.3,-0.0,1.3},
-{-0.3,0.8,1.0},
-{-0.5,0.7,1.0},
-{-0.3,0.6,1.1},
-{-0.7,0.7,0.9},
-{-0.8,0.6,0.8},
-{-0.7,0.5,1.0},
-{0.8,-0.0,1.0},
-{0.8,0.3,1.0},
-{0.6,-0.0,1.2},
-{0.7,0.5,1.0},
-{0.7,0.7,0.9},
-{0.5,0.5,1.1},
-{0.3,0.6,1.1},
-{0.3,0.8,1.0},
-{0.0,0.6,1.2},
-{0.7,-0.7,0.9},
-{0.5,-0.7,1.0},
-{0.6,-0.8,0.8},
-{0.8,-0.3,1.0},
-{0.6,-0.3,1.1},
-{0.7,-0.5,1.0},
-{0.3,-0.3,1.2},
-{-0.0,-0.3,1.3},
-{0.3,-0.6,1.1},
-{1.2,0.3,0.3},
-{1.1,0.3,0.6},
-{1.3,-0.0,0.3},
-{1.0,0.8,0.3},
-{1.0,0.7,0.5},
-{1.1,0.6,0.3},
-{0.9,0.7,0.7},
-{0.8,0.6,0.8},
-{1.0,0.5,0.7},
-{1.0,-0.0,-0.8},
-{1.0,0.3,-0.8},
-{1.2,-0.0,-0.6},
-{1.0,0.5,-0.7},
-{0.9,0.7,-0.7},
-{1.1,0.5,-0.5},
-{1.1,0.6,-0.3},
-{1.0,0.8,-0.3},
-{1.2,0.6,0.0},
-{0.9,-0.7,-0.7},
-{1.0,-0.7,-0.5},
-{0.8,-0.8,-0.6},
-{1.0,-0.3,-0.8},
-{1.1,-0.3,-0.6},
-{1.0,-0.5,-0.7},
-{1.2,-0.3,-0.3},
-{1.3,-0.3,0.0},
-{1.1,-0.6,-0.3},
-{0.3,-1.2,0.3},
-{0.3,-1.1,0.6},
-{-0.0,-1.3,0.3},
-{0.8,-1.0,0.3},
-{0.7,-1.0,0.5},
-{0.6,-1.1,0.3},
-{0.7,-0.9,0.7},
-{0.6,-0.8,0.8},
-{0.5,-1.0,0.7},
-{-0.0,-1.0,-0.8},
-{0.3,-1.0,-0.8},
-{-0.0,-1.2,-0.6},
-{0.5,-1.0,-0.7},
-{0.7,-0.9,-0.7},
-{0.5,-1.1,-0.5},
-{0.6,-1.1,-0.3},
-{0.8,-1.0,-0.3},
-{0.6,-1.2,0.0},
-{-0.7,-0.9,-0.7},
-{-0.7,-1.0,-0.5},
-{-0.8,-0.8,-0.6},
-{-0.3,-1.0,-0.8},
-{-0.3,-1.1,-0.6},
-{-0.5,-1.0,-0.7},
-{-0.3,-1.2,-0.3},
-{-0.3,-1.3,0.0},
-{-0.6,-1.1,-0.3},
-{-1.2,-0.3,0.3},
-{-1.1,-0.3,0.6},
-{-1.3,0.0,0.3},
-{-1.0,-0.8,0.3},
-{-1.0,-0.7,0.5},
-{-1.1,-0.6,0.3},
-{-0.9,-0.7,0.7},
-{-0.8,-0.6,0.8},
-{-1.0,-0.5,0.7},
-{-1.0,0.0,-0.8},
-{-1.0,-0.3,-0.8},
-{-1.2,0.0,-0.6},
-{-1.0,-0.5,-0.7},
-{-0.9,-0.7,-0.7},
-{-1.1,-0.5,-0.5},
-{-1.1,-0.6,-0.3},
-{-1.0,-0.8,-0.3},
-{-1.2,-0.6,0.0},
-{-0.9,0.7,-0.7},
-{-1.0,0.7,-0.5},
-{-0.8,0.8,-0.6},
-{-1.0,0.3,-0.8},
-{-1.1,0.3,-0.6},
-{-1.0,0.5,-0.7},
-{-1.2,0.3,-0.3},
-{-1.3,0.3,0.0},
-{-1.1,0.6,-0.3},
-{0.3,1.2,-0.3},
-{0.3,1.1,-0.6},
-{0.0,1.3,-0.3},
-{0.8,1.0,-0.3},
-{0.7,1.0,-0.5},
-{0.6,1.1,-0.3},
-{0.7,0.9,-0.7},
-{0.6,0.8,-0.8},
-{0.5,1.0,-0.7},
-{0.0,1.0,0.8},
-{0.3,1.0,0.8},
-{0.0,1.2,0.6},
-{0.5,1.0,0.7},
-{0.7,0.9,0.7},
-{0.5,1.1,0.5},
-{0.6,1.1,0.3},
-{0.8,1.0,0.3},
-{0.6,1.2,0.0},
-{-0.7,0.9,0.7},
-{-0.7,1.0,0.5},
-{-0.8,0.8,0.6},
-{-0.3,1.0,0.8},
-{-0.3,1.1,0.6},
-{-0.5,1.0,0.7},
-{-0.3,1.2,0.3},
-{-0.3,1.3,0.0},
-{-0.6,1.1,0.3},
-{-0.9,0.9,-0.2},
-{-0.8,1.0,-0.3},
-{-0.9,0.9,-0.4},
-{-0.6,1.1,-0.3},
-{-0.3,1.2,-0.3},
-{-0.5,1.1,-0.5},
-{-0.5,1.0,-0.7},
-{-0.3,1.0,-0.8},
-{-0.4,0.9,-0.9},
-{-0.9,0.9,0.2},
-{-1.0,0.8,0.3},
-{-0.9,0.9,0.4},
-{-1.1,0.6,0.3},
-{-1.2,0.3,0.3},
-{-1.1,0.5,0.5},
-{-1.0,0.5,0.7},
-{-1.0,0.3,0.8},
-{-0.9,0.4,0.9},
-{-0.9,-0.9,0.2},
-{-0.8,-1.0,0.3},
-{-0.9,-0.9,0.4},
-{-0.6,-1.1,0.3},
-{-0.3,-1.2,0.3},
-{-0.5,-1.1,0.5},
-{-0.5,-1.0,0.7},
-{-0.3,-1.0,0.8},
-{-0.4,-0.9,0.9},
-{0.9,-0.9,0.2},
-{1.0,-0.8,0.3},
-{0.9,-0.9,0.4},
-{1.1,-0.6,0.3},
-{1.2,-0.3,0.3},
-{1.1,-0.5,0.5},
-{1.0,-0.5,0.7},
-{1.0,-0.3,0.8},
-{0.9,-0.4,0.9},
-{-0.2,-0.9,0.9},
-{-0.3,-0.8,1.0},
-{-0.4,-0.9,0.9},
-{-0.3,-0.6,1.1},
-{-0.3,-0.3,1.2},
-{-0.5,-0.5,1.1},
-{-0.7,-0.5,1.0},
-{-0.8,-0.3,1.0},
-{-0.9,-0.4,0.9},
-{-0.9,-0.2,-0.9},
-{-0.8,-0.3,-1.0},
-{-0.9,-0.4,-0.9},
-{-0.6,-0.3,-1.1},
-{-0.3,-0.3,-1.2},
-{-0.5,-0.5,-1.1},
-{-0.5,-0.7,-1.0},
-{-0.3,-0.8,-1.0},
-{-0.4,-0.9,-0.9},
-{-0.5,-0.5,-1.1},
-{-0.3,-0.6,-1.1},
-{-0.5,-0.7,-1.0},
-{-0.3,-0.6,-1.1},
-{0.0,-0.6,-1.2},
-{-0.3,-0.8,-1.0},
-{-0.3,-0.8,-1.0},
-{0.0,-0.8,-1.0},
-{-0.2,-0.9,-0.9},
-{-0.6,0.0,-1.2},
-{-0.3,0.0,-1.3},
-{-0.6,-0.3,-1.1},
-{-0.3,0.0,-1.3},
-{0.0,0.0,-1.3},
-{-0.3,-0.3,-1.2},
-{-0.3,-0.3,-1.2},
-{0.0,-0.3,-1.3},
-{-0.3,-0.6,-1.1},
-{-0.9,0.0,-0.9},
-{-0.8,0.0,-1.0},
-{-0.9,-0.2,-0.9},
-{-0.8,0.0,-1.0},
-{-0.6,0.0,-1.2},
-{-0.8,-0.3,-1.0},
-{-0.8,-0.3,-1.0},
-{-0.6,-0.3,-1.1},
-{-0.7,-0.5,-1.0},
-{-0.5,-0.5,1.1},
-{-0.6,-0.3,1.1},
-{-0.7,-0.5,1.0},
-{-0.6,-0.3,1.1},
-{-0.6,0.0,1.2},
-{-0.8,-0.3,1.0},
-{-0.8,-0.3,1.0},
-{-0.8,0.0,1.0},
-{-0.9,-0.2,0.9},
-{-0.0,-0.6,1.2},
-{-0.0,-0.3,1.3},
-{-0.3,-0.6,1.1},
-{-0.0,-0.3,1.3},
-{-0.0,-0.0,1.3},
-{-0.3,-0.3,1.2},
-{-0.3,-0.3,1.2},
-{-0.3,-0.0,1.3},
-{-0.6,-0.3,1.1},
-{-0.0,-0.9,0.9},
-{-0.0,-0.8,1.0},
-{-0.2,-0.9,0.9},
-{-0.0,-0.8,1.0},
-{-0.0,-0.6,1.2},
-{-0.3,-0.8,1.0},
-{-0.3,-0.8,1.0},
-{-0.3,-0.6,1.1},
-{-0.5,-0.7,1.0},
-{1.1,-0.5,0.5},
-{1.1,-0.3,0.6},
-{1.0,-0.5,0.7},
-{1.1,-0.3,0.6},
-{1.2,-0.0,0.6},
-{1.0,-0.3,0.8},
-{1.0,-0.3,0.8},
-{1.0,-0.0,0.8},
-{0.9,-0.2,0.9},
-{1.2,-0.6,0.0},
-{1.3,-0.3,0.0},
-{1.1,-0.6,0.3},
-{1.3,-0.3,0.0},
-{1.3,-0.0,0.0},
-{1.2,-0.3,0.3},
-{1.2,-0.3,0.3},
-{1.3,-0.0,0.3},
-{1.1,-0.3,0.6},
-{0.9,-0.9,-0.0},
-{1.0,-0.8,0.0},
-{0.9,-0.9,0.2},
-{1.0,-0.8,0.0},
-{1.2,-0.6,0.0},
-{1.0,-0.8,0.3},
-{1.0,-0.8,0.3},
-{1.1,-0.6,0.3},
-{1.0,-0.7,0.5},
-{-0.5,-1.1,0.5},
-{-0.3,-1.1,0.6},
-{-0.5,-1.0,0.7},
-{-0.3,-1.1,0.6},
-{-0.0,-1.2,0.6},
-{-0.3,-1.0,0.8},
-{-0.3,-1.0,0.8},
-{-0.0,-1.0,0.8},
-{-0.2,-0.9,0.9},
-{-0.6,-1.2,0.0},
-{-0.3,-1.3,0.0},
-{-0.6,-1.1,0.3},
-{-0.3,-1.3,0.0},
-{-0.0,-1.3,0.0},
-{-0.3,-1.2,0.3},
-{-0.3,-1.2,0.3},
-{-0.0,-1.3,0.3},
-{-0.3,-1.1,0.6},
-{-0.9,-0.9,-0.0},
-{-0.8,-1.0,0.0},
-{-0.9,-0.9,0.2},
-{-0.8,-1.0,0.0},
-{-0.6,-1.2,0.0},
-{-0.8,-1.0,0.3},
-{-0.8,-1.0,0.3},
-{-0.6,-1.1,0.3},
-{-0.7,-1.0,0.5},
-{-1.1,0.5,0.5},
-{-1.1,0.3,0.6},
-{-1.0,0.5,0.7},
-{-1.1,0.3,0.6},
-{-1.2,0.0,0.6},
-{-1.0,0.3,0.8},
-{-1.0,0.3,0.8},
-{-1.0,0.0,0.8},
-{-0.9,0.2,0.9},
-{-1.2,0.6,0.0},
-{-1.3,0.3,0.0},
-{-1.1,0.6,0.3},
-{-1.3,0.3,0.0},
-{-1.3,0.0,0.0},
-{-1.2,0.3,0.3},
-{-1.2,0.3,0.3},
-{-1.3,0.0,0.3},
-{-1.1,0.3,0.6},
-{-0.9,0.9,-0.0},
-{-1.0,0.8,0.0},
-{-0.9,0.9,0.2},
-{-1.0,0.8,0.0},
-{-1.2,0.6,0.0},
-{-1.0,0.8,0.3},
-{-1.0,0.8,0.3},
-{-1.1,0.6,0.3},
-{-1.0,0.7,0.5},
-{-0.5,1.1,-0.5},
-{-0.3,1.1,-0.6},
-{-0.5,1.0,-0.7},
-{-0.3,1.1,-0.6},
-{0.0,1.2,-0.6},
-{-0.3,1.0,-0.8},
-{-0.3,1.0,-0.8},
-{0.0,1.0,-0.8},
-{-0.2,0.9,-0.9},
-{-0.6,1.2,0.0},
-{-0.3,1.3,0.0},
-{-0.6,1.1,-0.3},
-{-0.3,1.3,0.0},
-{0.0,1.3,0.0},
-{-0.3,1.2,-0.3},
-{-0.3,1.2,-0.3},
-{0.0,1.3,-0.3},
-{-0.3,1.1,-0.6},
-{-0.9,0.9,-0.0},
-{-0.8,1.0,0.0},
-{-0.9,0.9,-0.2},
-{-0.8,1.0,0.0},
-{-0.6,1.2,0.0},
-{-0.8,1.0,-0.3},
-{-0.8,1.0,-0.3},
-{-0.6,1.1,-0.3},
-{-0.7,1.0,-0.5},
-{-0.3,1.1,0.6},
-{-0.3,1.2,0.3},
-{-0.5,1.1,0.5},
-{0.0,1.2,0.6},
-{0.0,1.3,0.3},
-{-0.3,1.1,0.6},
-{0.0,1.3,0.3},
-{0.0,1.3,0.0},
-{-0.3,1.2,0.3},
-{-0.2,0.9,0.9},
-{-0.3,1.0,0.8},
-{-0.4,0.9,0.9},
-{0.0,0.9,0.9},
-{0.0,1.0,0.8},
-{-0.2,0.9,0.9},
-{0.0,1.0,0.8},
-{0.0,1.2,0.6},
-{-0.3,1.0,0.8},
-{-0.6,0.8,0.8},
-{-0.7,0.9,0.7},
-{-0.7,0.7,0.7},
-{-0.4,0.9,0.9},
-{-0.5,1.0,0.7},
-{-0.6,0.8,0.8},
-{-0.5,1.0,0.7},
-{-0.5,1.1,0.5},
-{-0.7,0.9,0.7},
-{0.5,1.1,0.5},
-{0.7,1.0,0.5},
-{0.6,1.1,0.3},
-{0.7,1.0,0.5},
-{0.9,0.9,0.4},
-{0.8,1.0,0.3},
-{0.8,1.0,0.3},
-{0.9,0.9,0.2},
-{0.8,1.0,0.0},
-{0.4,0.9,0.9},
-{0.6,0.8,0.8},
-{0.5,1.0,0.7},
-{0.6,0.8,0.8},
-{0.7,0.7,0.7},
-{0.7,0.9,0.7},
-{0.7,0.9,0.7},
-{0.8,0.8,0.6},
-{0.7,1.0,0.5},
-{0.0,0.9,0.9},
-{0.2,0.9,0.9},
-{0.0,1.0,0.8},
-{0.2,0.9,0.9},
-{0.4,0.9,0.9},
-{0.3,1.0,0.8},
-{0.3,1.0,0.8},
-{0.5,1.0,0.7},
-{0.3,1.1,0.6},
-{0.7,1.0,-0.5},
-{0.7,0.9,-0.7},
-{0.5,1.1,-0.5},
-{0.9,0.9,-0.4},
-{0.8,0.8,-0.6},
-{0.7,1.0,-0.5},
-{0.8,0.8,-0.6},
-{0.7,0.7,-0.7},
-{0.7,0.9,-0.7},
-{0.8,1.0,0.0},
-{0.8,1.0,-0.3},
-{0.6,1.2,0.0},
-{0.9,0.9,-0.0},
-{0.9,0.9,-0.2},
-{0.8,1.0,0.0},
-{0.9,0.9,-0.2},
-{0.9,0.9,-0.4},
-{0.8,1.0,-0.3},
-{0.3,1.3,0.0},
-{0.3,1.2,-0.3},
-{0.0,1.3,0.0},
-{0.6,1.2,0.0},
-{0.6,1.1,-0.3},
-{0.3,1.3,0.0},
-{0.6,1.1,-0.3},
-{0.5,1.1,-0.5},
-{0.3,1.2,-0.3},
-{-1.1,0.3,-0.6},
-{-1.2,0.3,-0.3},
-{-1.1,0.5,-0.5},
-{-1.2,0.0,-0.6},
-{-1.3,0.0,-0.3},
-{-1.1,0.3,-0.6},
-{-1.3,0.0,-0.3},
-{-1.3,0.0,0.0},
-{-1.2,0.3,-0.3},
-{-0.9,0.2,-0.9},
-{-1.0,0.3,-0.8},
-{-0.9,0.4,-0.9},
-{-0.9,0.0,-0.9},
-{-1.0,0.0,-0.8},
-{-0.9,0.2,-0.9},
-{-1.0,0.0,-0.8},
-{-1.2,0.0,-0.6},
-{-1.0,0.3,-0.8},
-{-0.8,0.6,-0.8},
-{-0.9,0.7,-0.7},
-{-0.7,0.7,-0.7},
-{-0.9,0.4,-0.9},
-{-1.0,0.5,-0.7},
-{-0.8,0.6,-0.8},
-{-1.0,0.5,-0.7},
-{-1.1,0.5,-0.5},
-{-0.9,0.7,-0.7},
-{-1.1,-0.5,-0.5},
-{-1.0,-0.7,-0.5},
-{-1.1,-0.6,-0.3},
-{-1.0,-0.7,-0.5},
-{-0.9,-0.9,-0.4},
-{-1.0,-0.8,-0.3},
-{-1.0,-0.8,-0.3},
-{-0.9,-0.9,-0.2},
-{-1.0,-0.8,0.0},
-{-0.9,-0.4,-0.9},
-{-0.8,-0.6,-0.8},
-{-1.0,-0.5,-0.7},
-{-0.8,-0.6,-0.8},
-{-0.7,-0.7,-0.7},
-{-0.9,-0.7,-0.7},
-{-0.9,-0.7,-0.7},
-{-0.8,-0.8,-0.6},
-{-1.0,-0.7,-0.5},
-{-0.9,0.0,-0.9},
-{-0.9,-0.2,-0.9},
-{-1.0,0.0,-0.8},
-{-0.9,-0.2,-0.9},
-{-0.9,-0.4,-0.9},
-{-1.0,-0.3,-0.8},
-{-1.0,-0.3,-0.8},
-{-1.0,-0.5,-0.7},
-{-1.1,-0.3,-0.6},
-{-1.0,-0.7,0.5},
-{-0.9,-0.7,0.7},
-{-1.1,-0.5,0.5},
-{-0.9,-0.9,0.4},
-{-0.8,-0.8,0.6},
-{-1.0,-0.7,0.5},
-{-0.8,-0.8,0.6},
-{-0.7,-0.7,0.7},
-{-0.9,-0.7,0.7},
-{-1.0,-0.8,0.0},
-{-1.0,-0.8,0.3},
-{-1.2,-0.6,0.0},
-{-0.9,-0.9,-0.0},
-{-0.9,-0.9,0.2},
-{-1.0,-0.8,0.0},
-{-0.9,-0.9,0.2},
-{-0.9,-0.9,0.4},
-{-1.0,-0.8,0.3},
-{-1.3,-0.3,0.0},
-{-1.2,-0.3,0.3},
-{-1.3,0.0,0.0},
-{-1.2,-0.6,0.0},
-{-1.1,-0.6,0.3},
-{-1.3,-0.3,0.0},
-{-1.1,-0.6,0.3},
-{-1.1,-0.5,0.5},
-{-1.2,-0.3,0.3},
-{-0.3,-1.1,-0.6},
-{-0.3,-1.2,-0.3},
-{-0.5,-1.1,-0.5},
-{-0.0,-1.2,-0.6},
-{-0.0,-1.3,-0.3},
-{-0.3,-1.1,-0.6},
-{-0.0,-1.3,-0.3},
-{-0.0,-1.3,0.0},
-{-0.3,-1.2,-0.3},
-{-0.2,-0.9,-0.9},
-{-0.3,-1.0,-0.8},
-{-0.4,-0.9,-0.9},
-{-0.0,-0.9,-0.9},
-{-0.0,-1.0,-0.8},
-{-0.2,-0.9,-0.9},
-{-0.0,-1.0,-0.8},
-{-0.0,-1.2,-0.6},
-{-0.3,-1.0,-0.8},
-{-0.6,-0.8,-0.8},
-{-0.7,-0.9,-0.7},
-{-0.7,-0.7,-0.7},
-{-0.4,-0.9,-0.9},
-{-0.5,-1.0,-0.7},
-{-0.6,-0.8,-0.8},
-{-0.5,-1.0,-0.7},
-{-0.5,-1.1,-0.5},
-{-0.7,-0.9,-0.7},
-{0.5,-1.1,-0.5},
-{0.7,-1.0,-0.5},
-{0.6,-1.1,-0.3},
-{0.7,-1.0,-0.5},
-{0.9,-0.9,-0.4},
-{0.8,-1.0,-0.3},
-{0.8,-1.0,-0.3},
-{0.9,-0.9,-0.2},
-{0.8,-1.0,0.0},
-{0.4,-0.9,-0.9},
-{0.6,-0.8,-0.8},
-{0.5,-1.0,-0.7},
-{0.6,-0.8,-0.8},
-{0.7,-0.7,-0.7},
-{0.7,-0.9,-0.7},
-{0.7,-0.9,-0.7},
-{0.8,-0.8,-0.6},
-{0.7,-1.0,-0.5},
-{-0.0,-0.9,-0.9},
-{0.2,-0.9,-0.9},
-{-0.0,-1.0,-0.8},
-{0.2,-0.9,-0.9},
-{0.4,-0.9,-0.9},
-{0.3,-1.0,-0.8},
-{0.3,-1.0,-0.8},
-{0.5,-1.0,-0.7},
-{0.3,-1.1,-0.6},
-{0.7,-1.0,0.5},
-{0.7,-0.9,0.7},
-{0.5,-1.1,0.5},
-{0.9,-0.9,0.4},
-{0.8,-0.8,0.6},
-{0.7,-1.0,0.5},
-{0.8,-0.8,0.6},
-{0.7,-0.7,0.7},
-{0.7,-0.9,0.7},
-{0.8,-1.0,0.0},
-{0.8,-1.0,0.3},
-{0.6,-1.2,0.0},
-{0.9,-0.9,-0.0},
-{0.9,-0.9,0.2},
-{0.8,-1.0,0.0},
-{0.9,-0.9,0.2},
-{0.9,-0.9,0.4},
-{0.8,-1.0,0.3},
-{0.3,-1.3,0.0},
-{0.3,-1.2,0.3},
-{-0.0,-1.3,0.0},
-{0.6,-1.2,0.0},
-{0.6,-1.1,0.3},
-{0.3,-1.3,0.0},
-{0.6,-1.1,0.3},
-{0.5,-1.1,0.5},
-{0.3,-1.2,0.3},
-{1.1,-0.3,-0.6},
-{1.2,-0.3,-0.3},
-{1.1,-0.5,-0.5},
-{1.2,-0.0,-0.6},
-{1.3,-0.0,-0.3},
-{1.1,-0.3,-0.6},
-{1.3,-0.0,-0.3},
-{1.3,-0.0,0.0},
-{1.2,-0.3,-0.3},
-{0.9,-0.2,-0.9},
-{1.0,-0.3,-0.8},
-{0.9,-0.4,-0.9},
-{0.9,-0.0,-0.9},
-{1.0,-0.0,-0.8},
-{0.9,-0.2,-0.9},
-{1.0,-0.0,-0.8},
-{1.2,-0.0,-0.6},
-{1.0,-0.3,-0.8},
-{0.8,-0.6,-0.8},
-{0.9,-0.7,-0.7},
-{0.7,-0.7,-0.7},
-{0.9,-0.4,-0.9},
-{1.0,-0.5,-0.7},
-{0.8,-0.6,-0.8},
-{1.0,-0.5,-0.7},
-{1.1,-0.5,-0.5},
-{0.9,-0.7,-0.7},
-{1.1,0.5,-0.5},
-{1.0,0.7,-0.5},
-{1.1,0.6,-0.3},
-{1.0,0.7,-0.5},
-{0.9,0.9,-0.4},
-{1.0,0.8,-0.3},
-{1.0,0.8,-0.3},
-{0.9,0.9,-0.2},
-{1.0,0.8,0.0},
-{0.9,0.4,-0.9},
-{0.8,0.6,-0.8},
-{1.0,0.5,-0.7},
-{0.8,0.6,-0.8},
-{0.7,0.7,-0.7},
-{0.9,0.7,-0.7},
-{0.9,0.7,-0.7},
-{0.8,0.8,-0.6},
-{1.0,0.7,-0.5},
-{0.9,-0.0,-0.9},
-{0.9,0.2,-0.9},
-{1.0,-0.0,-0.8},
-{0.9,0.2,-0.9},
-{0.9,0.4,-0.9},
-{1.0,0.3,-0.8},
-{1.0,0.3,-0.8},
-{1.0,0.5,-0.7},
-{1.1,0.3,-0.6},
-{1.0,0.7,0.5},
-{0.9,0.7,0.7},
-{1.1,0.5,0.5},
-{0.9,0.9,0.4},
-{0.8,0.8,0.6},
-{1.0,0.7,0.5},
-{0.8,0.8,0.6},
-{0.7,0.7,0.7},
-{0.9,0.7,0.7},
-{1.0,0.8,0.0},
-{1.0,0.8,0.3},
-{1.2,0.6,0.0},
-{0.9,0.9,-0.0},
-{0.9,0.9,0.2},
-{1.0,0.8,0.0},
-{0.9,0.9,0.2},
-{0.9,0.9,0.4},
-{1.0,0.8,0.3},
-{1.3,0.3,0.0},
-{1.2,0.3,0.3},
-{1.3,-0.0,0.0},
-{1.2,0.6,0.0},
-{1.1,0.6,0.3},
-{1.3,0.3,0.0},
-{1.1,0.6,0.3},
-{1.1,0.5,0.5},
-{1.2,0.3,0.3},
-{0.6,-0.3,1.1},
-{0.3,-0.3,1.2},
-{0.5,-0.5,1.1},
-{0.6,-0.0,1.2},
-{0.3,-0.0,1.3},
-{0.6,-0.3,1.1},
-{0.3,-0.0,1.3},
-{-0.0,-0.0,1.3},
-{0.3,-0.3,1.2},
-{0.9,-0.2,0.9},
-{0.8,-0.3,1.0},
-{0.9,-0.4,0.9},
-{0.9,-0.0,0.9},
-{0.8,-0.0,1.0},
-{0.9,-0.2,0.9},
-{0.8,-0.0,1.0},
-{0.6,-0.0,1.2},
-{0.8,-0.3,1.0},
-{0.8,-0.6,0.8},
-{0.7,-0.7,0.9},
-{0.7,-0.7,0.7},
-{0.9,-0.4,0.9},
-{0.7,-0.5,1.0},
-{0.8,-0.6,0.8},
-{0.7,-0.5,1.0},
-{0.5,-0.5,1.1},
-{0.7,-0.7,0.9},
-{0.5,0.5,1.1},
-{0.5,0.7,1.0},
-{0.3,0.6,1.1},
-{0.5,0.7,1.0},
-{0.4,0.9,0.9},
-{0.3,0.8,1.0},
-{0.3,0.8,1.0},
-{0.2,0.9,0.9},
-{0.0,0.8,1.0},
-{0.9,0.4,0.9},
-{0.8,0.6,0.8},
-{0.7,0.5,1.0},
-{0.8,0.6,0.8},
-{0.7,0.7,0.7},
-{0.7,0.7,0.9},
-{0.7,0.7,0.9},
-{0.6,0.8,0.8},
-{0.5,0.7,1.0},
-{0.9,-0.0,0.9},
-{0.9,0.2,0.9},
-{0.8,-0.0,1.0},
-{0.9,0.2,0.9},
-{0.9,0.4,0.9},
-{0.8,0.3,1.0},
-{0.8,0.3,1.0},
-{0.7,0.5,1.0},
-{0.6,0.3,1.1},
-{-0.5,0.7,1.0},
-{-0.7,0.7,0.9},
-{-0.5,0.5,1.1},
-{-0.4,0.9,0.9},
-{-0.6,0.8,0.8},
-{-0.5,0.7,1.0},
-{-0.6,0.8,0.8},
-{-0.7,0.7,0.7},
-{-0.7,0.7,0.9},
-{0.0,0.8,1.0},
-{-0.3,0.8,1.0},
-{0.0,0.6,1.2},
-{0.0,0.9,0.9},
-{-0.2,0.9,0.9},
-{0.0,0.8,1.0},
-{-0.2,0.9,0.9},
-{-0.4,0.9,0.9},
-{-0.3,0.8,1.0},
-{-0.0,0.3,1.3},
-{-0.3,0.3,1.2},
-{-0.0,-0.0,1.3},
-{0.0,0.6,1.2},
-{-0.3,0.6,1.1},
-{-0.0,0.3,1.3},
-{-0.3,0.6,1.1},
-{-0.5,0.5,1.1},
-{-0.3,0.3,1.2},
-{-0.3,0.6,-1.1},
-{-0.3,0.3,-1.2},
-{-0.5,0.5,-1.1},
-{0.0,0.6,-1.2},
-{0.0,0.3,-1.3},
-{-0.3,0.6,-1.1},
-{0.0,0.3,-1.3},
-{0.0,0.0,-1.3},
-{-0.3,0.3,-1.2},
-{-0.2,0.9,-0.9},
-{-0.3,0.8,-1.0},
-{-0.4,0.9,-0.9},
-{0.0,0.9,-0.9},
-{0.0,0.8,-1.0},
-{-0.2,0.9,-0.9},
-{0.0,0.8,-1.0},
-{0.0,0.6,-1.2},
-{-0.3,0.8,-1.0},
-{-0.6,0.8,-0.8},
-{-0.7,0.7,-0.9},
-{-0.7,0.7,-0.7},
-{-0.4,0.9,-0.9},
-{-0.5,0.7,-1.0},
-{-0.6,0.8,-0.8},
-{-0.5,0.7,-1.0},
-{-0.5,0.5,-1.1},
-{-0.7,0.7,-0.9},
-{0.5,0.5,-1.1},
-{0.7,0.5,-1.0},
-{0.6,0.3,-1.1},
-{0.7,0.5,-1.0},
-{0.9,0.4,-0.9},
-{0.8,0.3,-1.0},
-{0.8,0.3,-1.0},
-{0.9,0.2,-0.9},
-{0.8,-0.0,-1.0},
-{0.4,0.9,-0.9},
-{0.6,0.8,-0.8},
-{0.5,0.7,-1.0},
-{0.6,0.8,-0.8},
-{0.7,0.7,-0.7},
-{0.7,0.7,-0.9},
-{0.7,0.7,-0.9},
-{0.8,0.6,-0.8},
-{0.7,0.5,-1.0},
-{0.0,0.9,-0.9},
-{0.2,0.9,-0.9},
-{0.0,0.8,-1.0},
-{0.2,0.9,-0.9},
-{0.4,0.9,-0.9},
-{0.3,0.8,-1.0},
-{0.3,0.8,-1.0},
-{0.5,0.7,-1.0},
-{0.3,0.6,-1.1},
-{0.7,-0.5,-1.0},
-{0.7,-0.7,-0.9},
-{0.5,-0.5,-1.1},
-{0.9,-0.4,-0.9},
-{0.8,-0.6,-0.8},
-{0.7,-0.5,-1.0},
-{0.8,-0.6,-0.8},
-{0.7,-0.7,-0.7},
-{0.7,-0.7,-0.9},
-{0.8,-0.0,-1.0},
-{0.8,-0.3,-1.0},
-{0.6,0.0,-1.2},
-{0.9,-0.0,-0.9},
-{0.9,-0.2,-0.9},
-{0.8,-0.0,-1.0},
-{0.9,-0.2,-0.9},
-{0.9,-0.4,-0.9},
-{0.8,-0.3,-1.0},
-{0.3,0.0,-1.3},
-{0.3,-0.3,-1.2},
-{0.0,0.0,-1.3},
-{0.6,0.0,-1.2},
-{0.6,-0.3,-1.1},
-{0.3,0.0,-1.3},
-{0.6,-0.3,-1.1},
-{0.5,-0.5,-1.1},
-{0.3,-0.3,-1.2},
-{0.3,-0.6,-1.1},
-{0.3,-0.8,-1.0},
-{0.0,-0.6,-1.2},
-{0.5,-0.5,-1.1},
-{0.5,-0.7,-1.0},
-{0.3,-0.6,-1.1},
-{0.5,-0.7,-1.0},
-{0.4,-0.9,-0.9},
-{0.3,-0.8,-1.0},
-{0.0,0.6,-1.2},
-{0.3,0.6,-1.1},
-{0.0,0.3,-1.3},
-{0.3,0.6,-1.1},
-{0.5,0.5,-1.1},
-{0.3,0.3,-1.2},
-{0.3,0.3,-1.2},
-{0.6,0.3,-1.1},
-{0.3,0.0,-1.3},
-{-0.7,0.5,-1.0},
-{-0.8,0.3,-1.0},
-{-0.9,0.4,-0.9},
-{-0.5,0.5,-1.1},
-{-0.6,0.3,-1.1},
-{-0.7,0.5,-1.0},
-{-0.6,0.3,-1.1},
-{-0.6,0.0,-1.2},
-{-0.8,0.3,-1.0},
-{-0.6,0.3,1.1},
-{-0.8,0.3,1.0},
-{-0.6,0.0,1.2},
-{-0.5,0.5,1.1},
-{-0.7,0.5,1.0},
-{-0.6,0.3,1.1},
-{-0.7,0.5,1.0},
-{-0.9,0.4,0.9},
-{-0.8,0.3,1.0},
-{0.6,-0.0,1.2},
-{0.6,0.3,1.1},
-{0.3,-0.0,1.3},
-{0.6,0.3,1.1},
-{0.5,0.5,1.1},
-{0.3,0.3,1.2},
-{0.3,0.3,1.2},
-{0.3,0.6,1.1},
-{-0.0,0.3,1.3},
-{0.5,-0.7,1.0},
-{0.3,-0.8,1.0},
-{0.4,-0.9,0.9},
-{0.5,-0.5,1.1},
-{0.3,-0.6,1.1},
-{0.5,-0.7,1.0},
-{0.3,-0.6,1.1},
-{-0.0,-0.6,1.2},
-{0.3,-0.8,1.0},
-{1.1,0.3,0.6},
-{1.0,0.3,0.8},
-{1.2,-0.0,0.6},
-{1.1,0.5,0.5},
-{1.0,0.5,0.7},
-{1.1,0.3,0.6},
-{1.0,0.5,0.7},
-{0.9,0.4,0.9},
-{1.0,0.3,0.8},
-{1.2,-0.0,-0.6},
-{1.1,0.3,-0.6},
-{1.3,-0.0,-0.3},
-{1.1,0.3,-0.6},
-{1.1,0.5,-0.5},
-{1.2,0.3,-0.3},
-{1.2,0.3,-0.3},
-{1.1,0.6,-0.3},
-{1.3,0.3,0.0},
-{1.0,-0.7,-0.5},
-{1.0,-0.8,-0.3},
-{0.9,-0.9,-0.4},
-{1.1,-0.5,-0.5},
-{1.1,-0.6,-0.3},
-{1.0,-0.7,-0.5},
-{1.1,-0.6,-0.3},
-{1.2,-0.6,0.0},
-{1.0,-0.8,-0.3},
-{0.3,-1.1,0.6},
-{0.3,-1.0,0.8},
-{-0.0,-1.2,0.6},
-{0.5,-1.1,0.5},
-{0.5,-1.0,0.7},
-{0.3,-1.1,0.6},
-{0.5,-1.0,0.7},
-{0.4,-0.9,0.9},
-{0.3,-1.0,0.8},
-{-0.0,-1.2,-0.6},
-{0.3,-1.1,-0.6},
-{-0.0,-1.3,-0.3},
-{0.3,-1.1,-0.6},
-{0.5,-1.1,-0.5},
-{0.3,-1.2,-0.3},
-{0.3,-1.2,-0.3},
-{0.6,-1.1,-0.3},
-{0.3,-1.3,0.0},
-{-0.7,-1.0,-0.5},
-{-0.8,-1.0,-0.3},
-{-0.9,-0.9,-0.4},
-{-0.5,-1.1,-0.5},
-{-0.6,-1.1,-0.3},
-{-0.7,-1.0,-0.5},
-{-0.6,-1.1,-0.3},
-{-0.6,-1.2,0.0},
-{-0.8,-1.0,-0.3},
-{-1.1,-0.3,0.6},
-{-1.0,-0.3,0.8},
-{-1.2,0.0,0.6},
-{-1.1,-0.5,0.5},
-{-1.0,-0.5,0.7},
-{-1.1,-0.3,0.6},
-{-1.0,-0.5,0.7},
-{-0.9,-0.4,0.9},
-{-1.0,-0.3,0.8},
-{-1.2,0.0,-0.6},
-{-1.1,-0.3,-0.6},
-{-1.3,0.0,-0.3},
-{-1.1,-0.3,-0.6},
-{-1.1,-0.5,-0.5},
-{-1.2,-0.3,-0.3},
-{-1.2,-0.3,-0.3},
-{-1.1,-0.6,-0.3},
-{-1.3,-0.3,0.0},
-{-1.0,0.7,-0.5},
-{-1.0,0.8,-0.3},
-{-0.9,0.9,-0.4},
-{-1.1,0.5,-0.5},
-{-1.1,0.6,-0.3},
-{-1.0,0.7,-0.5},
-{-1.1,0.6,-0.3},
-{-1.2,0.6,0.0},
-{-1.0,0.8,-0.3},
-{0.3,1.1,-0.6},
-{0.3,1.0,-0.8},
-{0.0,1.2,-0.6},
-{0.5,1.1,-0.5},
-{0.5,1.0,-0.7},
-{0.3,1.1,-0.6},
-{0.5,1.0,-0.7},
-{0.4,0.9,-0.9},
-{0.3,1.0,-0.8},
-{0.0,1.2,0.6},
-{0.3,1.1,0.6},
-{0.0,1.3,0.3},
-{0.3,1.1,0.6},
-{0.5,1.1,0.5},
-{0.3,1.2,0.3},
-{0.3,1.2,0.3},
-{0.6,1.1,0.3},
-{0.3,1.3,0.0},
-{-0.7,1.0,0.5},
-{-0.8,1.0,0.3},
-{-0.9,0.9,0.4},
-{-0.5,1.1,0.5},
-{-0.6,1.1,0.3},
-{-0.7,1.0,0.5},
-{-0.6,1.1,0.3},
-{-0.6,1.2,0.0},
-{-0.8,1.0,0.3},
-{-0.9,0.9,-0.4},
-{-0.7,1.0,-0.5},
-{-0.8,0.8,-0.6},
-{-0.7,1.0,-0.5},
-{-0.5,1.1,-0.5},
-{-0.7,0.9,-0.7},
-{-0.7,0.9,-0.7},
-{-0.5,1.0,-0.7},
-{-0.6,0.8,-0.8},
-{-0.9,0.9,0.4},
-{-1.0,0.7,0.5},
-{-0.8,0.8,0.6},
-{-1.0,0.7,0.5},
-{-1.1,0.5,0.5},
-{-0.9,0.7,0.7},
-{-0.9,0.7,0.7},
-{-1.0,0.5,0.7},
-{-0.8,0.6,0.8},
-{-0.9,-0.9,0.4},
-{-0.7,-1.0,0.5},
-{-0.8,-0.8,0.6},
-{-0.7,-1.0,0.5},
-{-0.5,-1.1,0.5},
-{-0.7,-0.9,0.7},
-{-0.7,-0.9,0.7},
-{-0.5,-1.0,0.7},
-{-0.6,-0.8,0.8},
-{0.9,-0.9,0.4},
-{1.0,-0.7,0.5},
-{0.8,-0.8,0.6},
-{1.0,-0.7,0.5},
-{1.1,-0.5,0.5},
-{0.9,-0.7,0.7},
-{0.9,-0.7,0.7},
-{1.0,-0.5,0.7},
-{0.8,-0.6,0.8},
-{-0.4,-0.9,0.9},
-{-0.5,-0.7,1.0},
-{-0.6,-0.8,0.8},
-{-0.5,-0.7,1.0},
-{-0.5,-0.5,1.1},
-{-0.7,-0.7,0.9},
-{-0.7,-0.7,0.9},
-{-0.7,-0.5,1.0},
-{-0.8,-0.6,0.8},
-{-0.9,-0.4,-0.9},
-{-0.7,-0.5,-1.0},
-{-0.8,-0.6,-0.8},
-{-0.7,-0.5,-1.0},
-{-0.5,-0.5,-1.1},
-{-0.7,-0.7,-0.9},
-{-0.7,-0.7,-0.9},
-{-0.5,-0.7,-1.0},
-{-0.6,-0.8,-0.8},
-};
-
-const int numsphereVert = sizeof(sphereVert) / (sizeof(GLfloat)*3);
-
-const GLfloat sphereNorm[][3] = {
-{-0.5,-0.5,-0.7},
-{-0.5,-0.6,-0.6},
-{-0.6,-0.6,-0.6},
-{-0.5,-0.5,0.7},
-{-0.6,-0.5,0.6},
-{-0.6,-0.6,0.6},
-{0.7,-0.5,0.5},
-{0.6,-0.5,0.6},
-{0.6,-0.6,0.6},
-{-0.5,-0.7,0.5},
-{-0.5,-0.6,0.6},
-{-0.6,-0.6,0.6},
-{-0.7,0.5,0.5},
-{-0.6,0.5,0.6},
-{-0.6,0.6,0.6},
-{-0.5,0.7,-0.5},
-{-0.5,0.6,-0.6},
-{-0.6,0.6,-0.6},
-{-0.6,0.8,0.0},
-{-0.7,0.7,0.0},
-{-0.7,0.7,0.2},
-{0.2,0.9,0.2},
-{0.2,1.0,0.0},
-{0.0,1.0,0.0},
-{0.2,0.7,-0.7},
-{0.0,0.7,-0.7},
-{0.0,0.8,-0.6},
-{-0.8,0.6,0.0},
-{-0.7,0.7,0.0},
-{-0.7,0.7,-0.2},
-{-0.9,-0.2,-0.2},
-{-1.0,-0.2,0.0},
-{-1.0,0.0,0.0},
-{-0.7,-0.2,0.7},
-{-0.7,0.0,0.7},
-{-0.8,0.0,0.6},
-{-0.6,-0.8,0.0},
-{-0.7,-0.7,0.0},
-{-0.7,-0.7,-0.2},
-{0.2,-0.9,-0.2},
-{0.2,-1.0,0.0},
-{0.0,-1.0,0.0},
-{0.2,-0.7,0.7},
-{0.0,-0.7,0.7},
-{0.0,-0.8,0.6},
-{0.8,-0.6,0.0},
-{0.7,-0.7,0.0},
-{0.7,-0.7,-0.2},
-{0.9,0.2,-0.2},
-{1.0,0.2,0.0},
-{1.0,0.0,0.0},
-{0.7,0.2,0.7},
-{0.7,0.0,0.7},
-{0.8,0.0,0.6},
-{0.0,-0.6,0.8},
-{0.0,-0.7,0.7},
-{0.2,-0.7,0.7},
-{0.2,0.2,0.9},
-{0.0,0.2,1.0},
-{0.0,0.0,1.0},
-{-0.7,0.2,0.7},
-{-0.7,0.0,0.7},
-{-0.6,0.0,0.8},
-{-0.6,0.0,-0.8},
-{-0.7,0.0,-0.7},
-{-0.7,0.2,-0.7},
-{0.2,0.2,-0.9},
-{0.2,0.0,-1.0},
-{0.0,0.0,-1.0},
-{0.2,-0.7,-0.7},
-{0.0,-0.7,-0.7},
-{0.0,-0.6,-0.8},
-{0.2,-0.4,-0.9},
-{0.0,-0.4,-0.9},
-{0.0,-0.2,-1.0},
-{0.5,-0.4,-0.8},
-{0.4,-0.4,-0.8},
-{0.4,-0.2,-0.9},
-{0.5,-0.6,-0.6},
-{0.3,-0.7,-0.7},
-{0.4,-0.5,-0.8},
-{0.2,0.6,-0.8},
-{0.2,0.4,-0.9},
-{0.0,0.4,-0.9},
-{0.5,0.5,-0.7},
-{0.5,0.4,-0.8},
-{0.4,0.4,-0.8},
-{0.6,0.2,-0.8},
-{0.6,0.0,-0.8},
-{0.4,0.0,-0.9},
-{-0.5,0.4,-0.8},
-{-0.7,0.3,-0.7},
-{-0.6,0.5,-0.6},
-{-0.2,0.4,-0.9},
-{-0.4,0.4,-0.8},
-{-0.4,0.5,-0.8},
-{-0.2,0.0,-1.0},
-{-0.4,0.0,-0.9},
-{-0.4,0.2,-0.9},
-{-0.4,0.2,0.9},
-{-0.4,0.0,0.9},
-{-0.2,0.0,1.0},
-{-0.4,0.5,0.8},
-{-0.4,0.4,0.8},
-{-0.2,0.4,0.9},
-{-0.6,0.5,0.6},
-{-0.7,0.3,0.7},
-{-0.5,0.4,0.8},
-{0.6,0.2,0.8},
-{0.4,0.2,0.9},
-{0.4,0.0,0.9},
-{0.5,0.5,0.7},
-{0.4,0.5,0.8},
-{0.4,0.4,0.8},
-{0.2,0.6,0.8},
-{0.0,0.6,0.8},
-{0.0,0.4,0.9},
-{0.4,-0.5,0.8},
-{0.3,-0.7,0.7},
-{0.5,-0.6,0.6},
-{0.4,-0.2,0.9},
-{0.4,-0.4,0.8},
-{0.5,-0.4,0.8},
-{0.0,-0.2,1.0},
-{0.0,-0.4,0.9},
-{0.2,-0.4,0.9},
-{0.9,0.2,0.4},
-{0.9,0.0,0.4},
-{1.0,0.0,0.2},
-{0.8,0.5,0.4},
-{0.8,0.4,0.4},
-{0.9,0.4,0.2},
-{0.6,0.5,0.6},
-{0.7,0.3,0.7},
-{0.8,0.4,0.5},
-{0.8,0.2,-0.6},
-{0.9,0.2,-0.4},
-{0.9,0.0,-0.4},
-{0.7,0.5,-0.5},
-{0.8,0.5,-0.4},
-{0.8,0.4,-0.4},
-{0.8,0.6,-0.2},
-{0.8,0.6,0.0},
-{0.9,0.4,0.0},
-{0.8,-0.5,-0.4},
-{0.7,-0.7,-0.3},
-{0.6,-0.6,-0.5},
-{0.9,-0.2,-0.4},
-{0.8,-0.4,-0.4},
-{0.8,-0.4,-0.5},
-{1.0,-0.2,0.0},
-{0.9,-0.4,0.0},
-{0.9,-0.4,-0.2},
-{0.2,-0.9,0.4},
-{0.0,-0.9,0.4},
-{0.0,-1.0,0.2},
-{0.5,-0.8,0.4},
-{0.4,-0.8,0.4},
-{0.4,-0.9,0.2},
-{0.5,-0.6,0.6},
-{0.3,-0.7,0.7},
-{0.4,-0.8,0.5},
-{0.2,-0.8,-0.6},
-{0.2,-0.9,-0.4},
-{0.0,-0.9,-0.4},
-{0.5,-0.7,-0.5},
-{0.5,-0.8,-0.4},
-{0.4,-0.8,-0.4},
-{0.6,-0.8,-0.2},
-{0.6,-0.8,0.0},
-{0.4,-0.9,0.0},
-{-0.5,-0.8,-0.4},
-{-0.7,-0.7,-0.3},
-{-0.6,-0.6,-0.5},
-{-0.2,-0.9,-0.4},
-{-0.4,-0.8,-0.4},
-{-0.4,-0.8,-0.5},
-{-0.2,-1.0,0.0},
-{-0.4,-0.9,0.0},
-{-0.4,-0.9,-0.2},
-{-0.9,-0.2,0.4},
-{-0.9,0.0,0.4},
-{-1.0,0.0,0.2},
-{-0.8,-0.5,0.4},
-{-0.8,-0.4,0.4},
-{-0.9,-0.4,0.2},
-{-0.6,-0.5,0.6},
-{-0.7,-0.3,0.7},
-{-0.8,-0.4,0.5},
-{-0.8,-0.2,-0.6},
-{-0.9,-0.2,-0.4},
-{-0.9,0.0,-0.4},
-{-0.7,-0.5,-0.5},
-{-0.8,-0.5,-0.4},
-{-0.8,-0.4,-0.4},
-{-0.8,-0.6,-0.2},
-{-0.8,-0.6,0.0},
-{-0.9,-0.4,0.0},
-{-0.8,0.5,-0.4},
-{-0.7,0.7,-0.3},
-{-0.6,0.6,-0.5},
-{-0.9,0.2,-0.4},
-{-0.8,0.4,-0.4},
-{-0.8,0.4,-0.5},
-{-1.0,0.2,0.0},
-{-0.9,0.4,0.0},
-{-0.9,0.4,-0.2},
-{0.2,0.9,-0.4},
-{0.0,0.9,-0.4},
-{0.0,1.0,-0.2},
-{0.5,0.8,-0.4},
-{0.4,0.8,-0.4},
-{0.4,0.9,-0.2},
-{0.5,0.6,-0.6},
-{0.3,0.7,-0.7},
-{0.4,0.8,-0.5},
-{0.2,0.8,0.6},
-{0.2,0.9,0.4},
-{0.0,0.9,0.4},
-{0.5,0.7,0.5},
-{0.5,0.8,0.4},
-{0.4,0.8,0.4},
-{0.6,0.8,0.2},
-{0.6,0.8,0.0},
-{0.4,0.9,0.0},
-{-0.5,0.8,0.4},
-{-0.7,0.7,0.3},
-{-0.6,0.6,0.5},
-{-0.2,0.9,0.4},
-{-0.4,0.8,0.4},
-{-0.4,0.8,0.5},
-{-0.2,1.0,0.0},
-{-0.4,0.9,0.0},
-{-0.4,0.9,0.2},
-{-0.6,0.8,-0.2},
-{-0.5,0.8,-0.4},
-{-0.7,0.7,-0.3},
-{-0.2,0.9,-0.2},
-{-0.2,0.9,-0.4},
-{-0.4,0.8,-0.4},
-{-0.2,0.8,-0.6},
-{-0.2,0.7,-0.7},
-{-0.3,0.7,-0.7},
-{-0.8,0.6,0.2},
-{-0.8,0.5,0.4},
-{-0.7,0.7,0.3},
-{-0.9,0.2,0.2},
-{-0.9,0.2,0.4},
-{-0.8,0.4,0.4},
-{-0.8,0.2,0.6},
-{-0.7,0.2,0.7},
-{-0.7,0.3,0.7},
-{-0.6,-0.8,0.2},
-{-0.5,-0.8,0.4},
-{-0.7,-0.7,0.3},
-{-0.2,-0.9,0.2},
-{-0.2,-0.9,0.4},
-{-0.4,-0.8,0.4},
-{-0.2,-0.8,0.6},
-{-0.2,-0.7,0.7},
-{-0.3,-0.7,0.7},
-{0.8,-0.6,0.2},
-{0.8,-0.5,0.4},
-{0.7,-0.7,0.3},
-{0.9,-0.2,0.2},
-{0.9,-0.2,0.4},
-{0.8,-0.4,0.4},
-{0.8,-0.2,0.6},
-{0.7,-0.2,0.7},
-{0.7,-0.3,0.7},
-{-0.2,-0.6,0.8},
-{-0.4,-0.5,0.8},
-{-0.3,-0.7,0.7},
-{-0.2,-0.2,0.9},
-{-0.4,-0.2,0.9},
-{-0.4,-0.4,0.8},
-{-0.6,-0.2,0.8},
-{-0.7,-0.2,0.7},
-{-0.7,-0.3,0.7},
-{-0.6,-0.2,-0.8},
-{-0.5,-0.4,-0.8},
-{-0.7,-0.3,-0.7},
-{-0.2,-0.2,-0.9},
-{-0.2,-0.4,-0.9},
-{-0.4,-0.4,-0.8},
-{-0.2,-0.6,-0.8},
-{-0.2,-0.7,-0.7},
-{-0.3,-0.7,-0.7},
-{-0.2,-0.4,-0.9},
-{-0.2,-0.6,-0.8},
-{-0.4,-0.5,-0.8},
-{0.0,-0.4,-0.9},
-{0.0,-0.6,-0.8},
-{-0.2,-0.6,-0.8},
-{0.0,-0.6,-0.8},
-{0.0,-0.7,-0.7},
-{-0.2,-0.7,-0.7},
-{-0.2,0.0,-1.0},
-{-0.2,-0.2,-0.9},
-{-0.4,-0.2,-0.9},
-{0.0,0.0,-1.0},
-{0.0,-0.2,-1.0},
-{-0.2,-0.2,-0.9},
-{0.0,-0.2,-1.0},
-{0.0,-0.4,-0.9},
-{-0.2,-0.4,-0.9},
-{-0.6,0.0,-0.8},
-{-0.6,-0.2,-0.8},
-{-0.7,-0.2,-0.7},
-{-0.4,0.0,-0.9},
-{-0.4,-0.2,-0.9},
-{-0.6,-0.2,-0.8},
-{-0.4,-0.2,-0.9},
-{-0.4,-0.4,-0.8},
-{-0.5,-0.4,-0.8},
-{-0.4,-0.2,0.9},
-{-0.6,-0.2,0.8},
-{-0.5,-0.4,0.8},
-{-0.4,0.0,0.9},
-{-0.6,0.0,0.8},
-{-0.6,-0.2,0.8},
-{-0.6,0.0,0.8},
-{-0.7,0.0,0.7},
-{-0.7,-0.2,0.7},
-{0.0,-0.2,1.0},
-{-0.2,-0.2,0.9},
-{-0.2,-0.4,0.9},
-{0.0,0.0,1.0},
-{-0.2,0.0,1.0},
-{-0.2,-0.2,0.9},
-{-0.2,0.0,1.0},
-{-0.4,0.0,0.9},
-{-0.4,-0.2,0.9},
-{0.0,-0.6,0.8},
-{-0.2,-0.6,0.8},
-{-0.2,-0.7,0.7},
-{0.0,-0.4,0.9},
-{-0.2,-0.4,0.9},
-{-0.2,-0.6,0.8},
-{-0.2,-0.4,0.9},
-{-0.4,-0.4,0.8},
-{-0.4,-0.5,0.8},
-{0.9,-0.2,0.4},
-{0.8,-0.2,0.6},
-{0.8,-0.4,0.5},
-{0.9,0.0,0.4},
-{0.8,0.0,0.6},
-{0.8,-0.2,0.6},
-{0.8,0.0,0.6},
-{0.7,0.0,0.7},
-{0.7,-0.2,0.7},
-{1.0,-0.2,0.0},
-{0.9,-0.2,0.2},
-{0.9,-0.4,0.2},
-{1.0,0.0,0.0},
-{1.0,0.0,0.2},
-{0.9,-0.2,0.2},
-{1.0,0.0,0.2},
-{0.9,0.0,0.4},
-{0.9,-0.2,0.4},
-{0.8,-0.6,0.0},
-{0.8,-0.6,0.2},
-{0.7,-0.7,0.2},
-{0.9,-0.4,0.0},
-{0.9,-0.4,0.2},
-{0.8,-0.6,0.2},
-{0.9,-0.4,0.2},
-{0.8,-0.4,0.4},
-{0.8,-0.5,0.4},
-{-0.2,-0.9,0.4},
-{-0.2,-0.8,0.6},
-{-0.4,-0.8,0.5},
-{0.0,-0.9,0.4},
-{0.0,-0.8,0.6},
-{-0.2,-0.8,0.6},
-{0.0,-0.8,0.6},
-{0.0,-0.7,0.7},
-{-0.2,-0.7,0.7},
-{-0.2,-1.0,0.0},
-{-0.2,-0.9,0.2},
-{-0.4,-0.9,0.2},
-{0.0,-1.0,0.0},
-{0.0,-1.0,0.2},
-{-0.2,-0.9,0.2},
-{0.0,-1.0,0.2},
-{0.0,-0.9,0.4},
-{-0.2,-0.9,0.4},
-{-0.6,-0.8,0.0},
-{-0.6,-0.8,0.2},
-{-0.7,-0.7,0.2},
-{-0.4,-0.9,0.0},
-{-0.4,-0.9,0.2},
-{-0.6,-0.8,0.2},
-{-0.4,-0.9,0.2},
-{-0.4,-0.8,0.4},
-{-0.5,-0.8,0.4},
-{-0.9,0.2,0.4},
-{-0.8,0.2,0.6},
-{-0.8,0.4,0.5},
-{-0.9,0.0,0.4},
-{-0.8,0.0,0.6},
-{-0.8,0.2,0.6},
-{-0.8,0.0,0.6},
-{-0.7,0.0,0.7},
-{-0.7,0.2,0.7},
-{-1.0,0.2,0.0},
-{-0.9,0.2,0.2},
-{-0.9,0.4,0.2},
-{-1.0,0.0,0.0},
-{-1.0,0.0,0.2},
-{-0.9,0.2,0.2},
-{-1.0,0.0,0.2},
-{-0.9,0.0,0.4},
-{-0.9,0.2,0.4},
-{-0.8,0.6,0.0},
-{-0.8,0.6,0.2},
-{-0.7,0.7,0.2},
-{-0.9,0.4,0.0},
-{-0.9,0.4,0.2},
-{-0.8,0.6,0.2},
-{-0.9,0.4,0.2},
-{-0.8,0.4,0.4},
-{-0.8,0.5,0.4},
-{-0.2,0.9,-0.4},
-{-0.2,0.8,-0.6},
-{-0.4,0.8,-0.5},
-{0.0,0.9,-0.4},
-{0.0,0.8,-0.6},
-{-0.2,0.8,-0.6},
-{0.0,0.8,-0.6},
-{0.0,0.7,-0.7},
-{-0.2,0.7,-0.7},
-{-0.2,1.0,0.0},
-{-0.2,0.9,-0.2},
-{-0.4,0.9,-0.2},
-{0.0,1.0,0.0},
-{0.0,1.0,-0.2},
-{-0.2,0.9,-0.2},
-{0.0,1.0,-0.2},
-{0.0,0.9,-0.4},
-{-0.2,0.9,-0.4},
-{-0.6,0.8,0.0},
-{-0.6,0.8,-0.2},
-{-0.7,0.7,-0.2},
-{-0.4,0.9,0.0},
-{-0.4,0.9,-0.2},
-{-0.6,0.8,-0.2},
-{-0.4,0.9,-0.2},
-{-0.4,0.8,-0.4},
-{-0.5,0.8,-0.4},
-{-0.2,0.9,0.2},
-{-0.4,0.9,0.2},
-{-0.4,0.8,0.4},
-{0.0,1.0,0.2},
-{-0.2,0.9,0.2},
-{-0.2,0.9,0.4},
-{0.0,1.0,0.0},
-{-0.2,1.0,0.0},
-{-0.2,0.9,0.2},
-{-0.2,0.8,0.6},
-{-0.4,0.8,0.5},
-{-0.3,0.7,0.7},
-{0.0,0.8,0.6},
-{-0.2,0.8,0.6},
-{-0.2,0.7,0.7},
-{0.0,0.9,0.4},
-{-0.2,0.9,0.4},
-{-0.2,0.8,0.6},
-{-0.5,0.7,0.5},
-{-0.6,0.6,0.5},
-{-0.6,0.6,0.6},
-{-0.4,0.8,0.5},
-{-0.5,0.7,0.5},
-{-0.5,0.6,0.6},
-{-0.4,0.8,0.4},
-{-0.5,0.8,0.4},
-{-0.5,0.7,0.5},
-{0.5,0.8,0.4},
-{0.6,0.8,0.2},
-{0.4,0.9,0.2},
-{0.7,0.7,0.3},
-{0.7,0.7,0.2},
-{0.6,0.8,0.2},
-{0.7,0.7,0.2},
-{0.7,0.7,0.0},
-{0.6,0.8,0.0},
-{0.5,0.6,0.6},
-{0.5,0.7,0.5},
-{0.4,0.8,0.5},
-{0.6,0.6,0.6},
-{0.6,0.6,0.5},
-{0.5,0.7,0.5},
-{0.6,0.6,0.5},
-{0.7,0.7,0.3},
-{0.5,0.8,0.4},
-{0.2,0.7,0.7},
-{0.2,0.8,0.6},
-{0.0,0.8,0.6},
-{0.3,0.7,0.7},
-{0.4,0.8,0.5},
-{0.2,0.8,0.6},
-{0.4,0.8,0.5},
-{0.4,0.8,0.4},
-{0.2,0.9,0.4},
-{0.5,0.7,-0.5},
-{0.4,0.8,-0.5},
-{0.4,0.8,-0.4},
-{0.6,0.6,-0.5},
-{0.5,0.7,-0.5},
-{0.5,0.8,-0.4},
-{0.6,0.6,-0.6},
-{0.5,0.6,-0.6},
-{0.5,0.7,-0.5},
-{0.6,0.8,-0.2},
-{0.4,0.9,-0.2},
-{0.4,0.9,0.0},
-{0.7,0.7,-0.2},
-{0.6,0.8,-0.2},
-{0.6,0.8,0.0},
-{0.7,0.7,-0.3},
-{0.5,0.8,-0.4},
-{0.6,0.8,-0.2},
-{0.2,0.9,-0.2},
-{0.0,1.0,-0.2},
-{0.0,1.0,0.0},
-{0.4,0.9,-0.2},
-{0.2,0.9,-0.2},
-{0.2,1.0,0.0},
-{0.4,0.8,-0.4},
-{0.2,0.9,-0.4},
-{0.2,0.9,-0.2},
-{-0.9,0.2,-0.2},
-{-0.9,0.4,-0.2},
-{-0.8,0.4,-0.4},
-{-1.0,0.0,-0.2},
-{-0.9,0.2,-0.2},
-{-0.9,0.2,-0.4},
-{-1.0,0.0,0.0},
-{-1.0,0.2,0.0},
-{-0.9,0.2,-0.2},
-{-0.8,0.2,-0.6},
-{-0.8,0.4,-0.5},
-{-0.7,0.3,-0.7},
-{-0.8,0.0,-0.6},
-{-0.8,0.2,-0.6},
-{-0.7,0.2,-0.7},
-{-0.9,0.0,-0.4},
-{-0.9,0.2,-0.4},
-{-0.8,0.2,-0.6},
-{-0.7,0.5,-0.5},
-{-0.6,0.6,-0.5},
-{-0.6,0.6,-0.6},
-{-0.8,0.4,-0.5},
-{-0.7,0.5,-0.5},
-{-0.6,0.5,-0.6},
-{-0.8,0.4,-0.4},
-{-0.8,0.5,-0.4},
-{-0.7,0.5,-0.5},
-{-0.8,-0.5,-0.4},
-{-0.8,-0.6,-0.2},
-{-0.9,-0.4,-0.2},
-{-0.7,-0.7,-0.3},
-{-0.7,-0.7,-0.2},
-{-0.8,-0.6,-0.2},
-{-0.7,-0.7,-0.2},
-{-0.7,-0.7,0.0},
-{-0.8,-0.6,0.0},
-{-0.6,-0.5,-0.6},
-{-0.7,-0.5,-0.5},
-{-0.8,-0.4,-0.5},
-{-0.6,-0.6,-0.6},
-{-0.6,-0.6,-0.5},
-{-0.7,-0.5,-0.5},
-{-0.6,-0.6,-0.5},
-{-0.7,-0.7,-0.3},
-{-0.8,-0.5,-0.4},
-{-0.7,-0.2,-0.7},
-{-0.8,-0.2,-0.6},
-{-0.8,0.0,-0.6},
-{-0.7,-0.3,-0.7},
-{-0.8,-0.4,-0.5},
-{-0.8,-0.2,-0.6},
-{-0.8,-0.4,-0.5},
-{-0.8,-0.4,-0.4},
-{-0.9,-0.2,-0.4},
-{-0.7,-0.5,0.5},
-{-0.8,-0.4,0.5},
-{-0.8,-0.4,0.4},
-{-0.6,-0.6,0.5},
-{-0.7,-0.5,0.5},
-{-0.8,-0.5,0.4},
-{-0.6,-0.6,0.6},
-{-0.6,-0.5,0.6},
-{-0.7,-0.5,0.5},
-{-0.8,-0.6,0.2},
-{-0.9,-0.4,0.2},
-{-0.9,-0.4,0.0},
-{-0.7,-0.7,0.2},
-{-0.8,-0.6,0.2},
-{-0.8,-0.6,0.0},
-{-0.7,-0.7,0.3},
-{-0.8,-0.5,0.4},
-{-0.8,-0.6,0.2},
-{-0.9,-0.2,0.2},
-{-1.0,0.0,0.2},
-{-1.0,0.0,0.0},
-{-0.9,-0.4,0.2},
-{-0.9,-0.2,0.2},
-{-1.0,-0.2,0.0},
-{-0.8,-0.4,0.4},
-{-0.9,-0.2,0.4},
-{-0.9,-0.2,0.2},
-{-0.2,-0.9,-0.2},
-{-0.4,-0.9,-0.2},
-{-0.4,-0.8,-0.4},
-{0.0,-1.0,-0.2},
-{-0.2,-0.9,-0.2},
-{-0.2,-0.9,-0.4},
-{0.0,-1.0,0.0},
-{-0.2,-1.0,0.0},
-{-0.2,-0.9,-0.2},
-{-0.2,-0.8,-0.6},
-{-0.4,-0.8,-0.5},
-{-0.3,-0.7,-0.7},
-{0.0,-0.8,-0.6},
-{-0.2,-0.8,-0.6},
-{-0.2,-0.7,-0.7},
-{0.0,-0.9,-0.4},
-{-0.2,-0.9,-0.4},
-{-0.2,-0.8,-0.6},
-{-0.5,-0.7,-0.5},
-{-0.6,-0.6,-0.5},
-{-0.6,-0.6,-0.6},
-{-0.4,-0.8,-0.5},
-{-0.5,-0.7,-0.5},
-{-0.5,-0.6,-0.6},
-{-0.4,-0.8,-0.4},
-{-0.5,-0.8,-0.4},
-{-0.5,-0.7,-0.5},
-{0.5,-0.8,-0.4},
-{0.6,-0.8,-0.2},
-{0.4,-0.9,-0.2},
-{0.7,-0.7,-0.3},
-{0.7,-0.7,-0.2},
-{0.6,-0.8,-0.2},
-{0.7,-0.7,-0.2},
-{0.7,-0.7,0.0},
-{0.6,-0.8,0.0},
-{0.5,-0.6,-0.6},
-{0.5,-0.7,-0.5},
-{0.4,-0.8,-0.5},
-{0.6,-0.6,-0.6},
-{0.6,-0.6,-0.5},
-{0.5,-0.7,-0.5},
-{0.6,-0.6,-0.5},
-{0.7,-0.7,-0.3},
-{0.5,-0.8,-0.4},
-{0.2,-0.7,-0.7},
-{0.2,-0.8,-0.6},
-{0.0,-0.8,-0.6},
-{0.3,-0.7,-0.7},
-{0.4,-0.8,-0.5},
-{0.2,-0.8,-0.6},
-{0.4,-0.8,-0.5},
-{0.4,-0.8,-0.4},
-{0.2,-0.9,-0.4},
-{0.5,-0.7,0.5},
-{0.4,-0.8,0.5},
-{0.4,-0.8,0.4},
-{0.6,-0.6,0.5},
-{0.5,-0.7,0.5},
-{0.5,-0.8,0.4},
-{0.6,-0.6,0.6},
-{0.5,-0.6,0.6},
-{0.5,-0.7,0.5},
-{0.6,-0.8,0.2},
-{0.4,-0.9,0.2},
-{0.4,-0.9,0.0},
-{0.7,-0.7,0.2},
-{0.6,-0.8,0.2},
-{0.6,-0.8,0.0},
-{0.7,-0.7,0.3},
-{0.5,-0.8,0.4},
-{0.6,-0.8,0.2},
-{0.2,-0.9,0.2},
-{0.0,-1.0,0.2},
-{0.0,-1.0,0.0},
-{0.4,-0.9,0.2},
-{0.2,-0.9,0.2},
-{0.2,-1.0,0.0},
-{0.4,-0.8,0.4},
-{0.2,-0.9,0.4},
-{0.2,-0.9,0.2},
-{0.9,-0.2,-0.2},
-{0.9,-0.4,-0.2},
-{0.8,-0.4,-0.4},
-{1.0,0.0,-0.2},
-{0.9,-0.2,-0.2},
-{0.9,-0.2,-0.4},
-{1.0,0.0,0.0},
-{1.0,-0.2,0.0},
-{0.9,-0.2,-0.2},
-{0.8,-0.2,-0.6},
-{0.8,-0.4,-0.5},
-{0.7,-0.3,-0.7},
-{0.8,0.0,-0.6},
-{0.8,-0.2,-0.6},
-{0.7,-0.2,-0.7},
-{0.9,0.0,-0.4},
-{0.9,-0.2,-0.4},
-{0.8,-0.2,-0.6},
-{0.7,-0.5,-0.5},
-{0.6,-0.6,-0.5},
-{0.6,-0.6,-0.6},
-{0.8,-0.4,-0.5},
-{0.7,-0.5,-0.5},
-{0.6,-0.5,-0.6},
-{0.8,-0.4,-0.4},
-{0.8,-0.5,-0.4},
-{0.7,-0.5,-0.5},
-{0.8,0.5,-0.4},
-{0.8,0.6,-0.2},
-{0.9,0.4,-0.2},
-{0.7,0.7,-0.3},
-{0.7,0.7,-0.2},
-{0.8,0.6,-0.2},
-{0.7,0.7,-0.2},
-{0.7,0.7,0.0},
-{0.8,0.6,0.0},
-{0.6,0.5,-0.6},
-{0.7,0.5,-0.5},
-{0.8,0.4,-0.5},
-{0.6,0.6,-0.6},
-{0.6,0.6,-0.5},
-{0.7,0.5,-0.5},
-{0.6,0.6,-0.5},
-{0.7,0.7,-0.3},
-{0.8,0.5,-0.4},
-{0.7,0.2,-0.7},
-{0.8,0.2,-0.6},
-{0.8,0.0,-0.6},
-{0.7,0.3,-0.7},
-{0.8,0.4,-0.5},
-{0.8,0.2,-0.6},
-{0.8,0.4,-0.5},
-{0.8,0.4,-0.4},
-{0.9,0.2,-0.4},
-{0.7,0.5,0.5},
-{0.8,0.4,0.5},
-{0.8,0.4,0.4},
-{0.6,0.6,0.5},
-{0.7,0.5,0.5},
-{0.8,0.5,0.4},
-{0.6,0.6,0.6},
-{0.6,0.5,0.6},
-{0.7,0.5,0.5},
-{0.8,0.6,0.2},
-{0.9,0.4,0.2},
-{0.9,0.4,0.0},
-{0.7,0.7,0.2},
-{0.8,0.6,0.2},
-{0.8,0.6,0.0},
-{0.7,0.7,0.3},
-{0.8,0.5,0.4},
-{0.8,0.6,0.2},
-{0.9,0.2,0.2},
-{1.0,0.0,0.2},
-{1.0,0.0,0.0},
-{0.9,0.4,0.2},
-{0.9,0.2,0.2},
-{1.0,0.2,0.0},
-{0.8,0.4,0.4},
-{0.9,0.2,0.4},
-{0.9,0.2,0.2},
-{0.2,-0.2,0.9},
-{0.2,-0.4,0.9},
-{0.4,-0.4,0.8},
-{0.2,0.0,1.0},
-{0.2,-0.2,0.9},
-{0.4,-0.2,0.9},
-{0.0,0.0,1.0},
-{0.0,-0.2,1.0},
-{0.2,-0.2,0.9},
-{0.6,-0.2,0.8},
-{0.5,-0.4,0.8},
-{0.7,-0.3,0.7},
-{0.6,0.0,0.8},
-{0.6,-0.2,0.8},
-{0.7,-0.2,0.7},
-{0.4,0.0,0.9},
-{0.4,-0.2,0.9},
-{0.6,-0.2,0.8},
-{0.5,-0.5,0.7},
-{0.5,-0.6,0.6},
-{0.6,-0.6,0.6},
-{0.5,-0.4,0.8},
-{0.5,-0.5,0.7},
-{0.6,-0.5,0.6},
-{0.4,-0.4,0.8},
-{0.4,-0.5,0.8},
-{0.5,-0.5,0.7},
-{0.4,0.5,0.8},
-{0.2,0.6,0.8},
-{0.2,0.4,0.9},
-{0.3,0.7,0.7},
-{0.2,0.7,0.7},
-{0.2,0.6,0.8},
-{0.2,0.7,0.7},
-{0.0,0.7,0.7},
-{0.0,0.6,0.8},
-{0.6,0.5,0.6},
-{0.5,0.5,0.7},
-{0.5,0.4,0.8},
-{0.6,0.6,0.6},
-{0.5,0.6,0.6},
-{0.5,0.5,0.7},
-{0.5,0.6,0.6},
-{0.3,0.7,0.7},
-{0.4,0.5,0.8},
-{0.7,0.2,0.7},
-{0.6,0.2,0.8},
-{0.6,0.0,0.8},
-{0.7,0.3,0.7},
-{0.5,0.4,0.8},
-{0.6,0.2,0.8},
-{0.5,0.4,0.8},
-{0.4,0.4,0.8},
-{0.4,0.2,0.9},
-{-0.5,0.5,0.7},
-{-0.5,0.4,0.8},
-{-0.4,0.4,0.8},
-{-0.5,0.6,0.6},
-{-0.5,0.5,0.7},
-{-0.4,0.5,0.8},
-{-0.6,0.6,0.6},
-{-0.6,0.5,0.6},
-{-0.5,0.5,0.7},
-{-0.2,0.6,0.8},
-{-0.2,0.4,0.9},
-{0.0,0.4,0.9},
-{-0.2,0.7,0.7},
-{-0.2,0.6,0.8},
-{0.0,0.6,0.8},
-{-0.3,0.7,0.7},
-{-0.4,0.5,0.8},
-{-0.2,0.6,0.8},
-{-0.2,0.2,0.9},
-{-0.2,0.0,1.0},
-{0.0,0.0,1.0},
-{-0.2,0.4,0.9},
-{-0.2,0.2,0.9},
-{0.0,0.2,1.0},
-{-0.4,0.4,0.8},
-{-0.4,0.2,0.9},
-{-0.2,0.2,0.9},
-{-0.2,0.2,-0.9},
-{-0.4,0.2,-0.9},
-{-0.4,0.4,-0.8},
-{0.0,0.2,-1.0},
-{-0.2,0.2,-0.9},
-{-0.2,0.4,-0.9},
-{0.0,0.0,-1.0},
-{-0.2,0.0,-1.0},
-{-0.2,0.2,-0.9},
-{-0.2,0.6,-0.8},
-{-0.4,0.5,-0.8},
-{-0.3,0.7,-0.7},
-{0.0,0.6,-0.8},
-{-0.2,0.6,-0.8},
-{-0.2,0.7,-0.7},
-{0.0,0.4,-0.9},
-{-0.2,0.4,-0.9},
-{-0.2,0.6,-0.8},
-{-0.5,0.5,-0.7},
-{-0.6,0.5,-0.6},
-{-0.6,0.6,-0.6},
-{-0.4,0.5,-0.8},
-{-0.5,0.5,-0.7},
-{-0.5,0.6,-0.6},
-{-0.4,0.4,-0.8},
-{-0.5,0.4,-0.8},
-{-0.5,0.5,-0.7},
-{0.5,0.4,-0.8},
-{0.6,0.2,-0.8},
-{0.4,0.2,-0.9},
-{0.7,0.3,-0.7},
-{0.7,0.2,-0.7},
-{0.6,0.2,-0.8},
-{0.7,0.2,-0.7},
-{0.7,0.0,-0.7},
-{0.6,0.0,-0.8},
-{0.5,0.6,-0.6},
-{0.5,0.5,-0.7},
-{0.4,0.5,-0.8},
-{0.6,0.6,-0.6},
-{0.6,0.5,-0.6},
-{0.5,0.5,-0.7},
-{0.6,0.5,-0.6},
-{0.7,0.3,-0.7},
-{0.5,0.4,-0.8},
-{0.2,0.7,-0.7},
-{0.2,0.6,-0.8},
-{0.0,0.6,-0.8},
-{0.3,0.7,-0.7},
-{0.4,0.5,-0.8},
-{0.2,0.6,-0.8},
-{0.4,0.5,-0.8},
-{0.4,0.4,-0.8},
-{0.2,0.4,-0.9},
-{0.5,-0.5,-0.7},
-{0.4,-0.5,-0.8},
-{0.4,-0.4,-0.8},
-{0.6,-0.5,-0.6},
-{0.5,-0.5,-0.7},
-{0.5,-0.4,-0.8},
-{0.6,-0.6,-0.6},
-{0.5,-0.6,-0.6},
-{0.5,-0.5,-0.7},
-{0.6,-0.2,-0.8},
-{0.4,-0.2,-0.9},
-{0.4,0.0,-0.9},
-{0.7,-0.2,-0.7},
-{0.6,-0.2,-0.8},
-{0.6,0.0,-0.8},
-{0.7,-0.3,-0.7},
-{0.5,-0.4,-0.8},
-{0.6,-0.2,-0.8},
-{0.2,-0.2,-0.9},
-{0.0,-0.2,-1.0},
-{0.0,0.0,-1.0},
-{0.4,-0.2,-0.9},
-{0.2,-0.2,-0.9},
-{0.2,0.0,-1.0},
-{0.4,-0.4,-0.8},
-{0.2,-0.4,-0.9},
-{0.2,-0.2,-0.9},
-{0.2,-0.6,-0.8},
-{0.0,-0.6,-0.8},
-{0.0,-0.4,-0.9},
-{0.4,-0.5,-0.8},
-{0.2,-0.6,-0.8},
-{0.2,-0.4,-0.9},
-{0.3,-0.7,-0.7},
-{0.2,-0.7,-0.7},
-{0.2,-0.6,-0.8},
-{0.2,0.4,-0.9},
-{0.2,0.2,-0.9},
-{0.0,0.2,-1.0},
-{0.4,0.4,-0.8},
-{0.4,0.2,-0.9},
-{0.2,0.2,-0.9},
-{0.4,0.2,-0.9},
-{0.4,0.0,-0.9},
-{0.2,0.0,-1.0},
-{-0.6,0.2,-0.8},
-{-0.7,0.2,-0.7},
-{-0.7,0.3,-0.7},
-{-0.4,0.2,-0.9},
-{-0.6,0.2,-0.8},
-{-0.5,0.4,-0.8},
-{-0.4,0.0,-0.9},
-{-0.6,0.0,-0.8},
-{-0.6,0.2,-0.8},
-{-0.6,0.2,0.8},
-{-0.6,0.0,0.8},
-{-0.4,0.0,0.9},
-{-0.5,0.4,0.8},
-{-0.6,0.2,0.8},
-{-0.4,0.2,0.9},
-{-0.7,0.3,0.7},
-{-0.7,0.2,0.7},
-{-0.6,0.2,0.8},
-{0.4,0.2,0.9},
-{0.2,0.2,0.9},
-{0.2,0.0,1.0},
-{0.4,0.4,0.8},
-{0.2,0.4,0.9},
-{0.2,0.2,0.9},
-{0.2,0.4,0.9},
-{0.0,0.4,0.9},
-{0.0,0.2,1.0},
-{0.2,-0.6,0.8},
-{0.2,-0.7,0.7},
-{0.3,-0.7,0.7},
-{0.2,-0.4,0.9},
-{0.2,-0.6,0.8},
-{0.4,-0.5,0.8},
-{0.0,-0.4,0.9},
-{0.0,-0.6,0.8},
-{0.2,-0.6,0.8},
-{0.8,0.2,0.6},
-{0.8,0.0,0.6},
-{0.9,0.0,0.4},
-{0.8,0.4,0.5},
-{0.8,0.2,0.6},
-{0.9,0.2,0.4},
-{0.7,0.3,0.7},
-{0.7,0.2,0.7},
-{0.8,0.2,0.6},
-{0.9,0.2,-0.4},
-{0.9,0.2,-0.2},
-{1.0,0.0,-0.2},
-{0.8,0.4,-0.4},
-{0.9,0.4,-0.2},
-{0.9,0.2,-0.2},
-{0.9,0.4,-0.2},
-{0.9,0.4,0.0},
-{1.0,0.2,0.0},
-{0.8,-0.6,-0.2},
-{0.7,-0.7,-0.2},
-{0.7,-0.7,-0.3},
-{0.9,-0.4,-0.2},
-{0.8,-0.6,-0.2},
-{0.8,-0.5,-0.4},
-{0.9,-0.4,0.0},
-{0.8,-0.6,0.0},
-{0.8,-0.6,-0.2},
-{0.2,-0.8,0.6},
-{0.0,-0.8,0.6},
-{0.0,-0.9,0.4},
-{0.4,-0.8,0.5},
-{0.2,-0.8,0.6},
-{0.2,-0.9,0.4},
-{0.3,-0.7,0.7},
-{0.2,-0.7,0.7},
-{0.2,-0.8,0.6},
-{0.2,-0.9,-0.4},
-{0.2,-0.9,-0.2},
-{0.0,-1.0,-0.2},
-{0.4,-0.8,-0.4},
-{0.4,-0.9,-0.2},
-{0.2,-0.9,-0.2},
-{0.4,-0.9,-0.2},
-{0.4,-0.9,0.0},
-{0.2,-1.0,0.0},
-{-0.6,-0.8,-0.2},
-{-0.7,-0.7,-0.2},
-{-0.7,-0.7,-0.3},
-{-0.4,-0.9,-0.2},
-{-0.6,-0.8,-0.2},
-{-0.5,-0.8,-0.4},
-{-0.4,-0.9,0.0},
-{-0.6,-0.8,0.0},
-{-0.6,-0.8,-0.2},
-{-0.8,-0.2,0.6},
-{-0.8,0.0,0.6},
-{-0.9,0.0,0.4},
-{-0.8,-0.4,0.5},
-{-0.8,-0.2,0.6},
-{-0.9,-0.2,0.4},
-{-0.7,-0.3,0.7},
-{-0.7,-0.2,0.7},
-{-0.8,-0.2,0.6},
-{-0.9,-0.2,-0.4},
-{-0.9,-0.2,-0.2},
-{-1.0,0.0,-0.2},
-{-0.8,-0.4,-0.4},
-{-0.9,-0.4,-0.2},
-{-0.9,-0.2,-0.2},
-{-0.9,-0.4,-0.2},
-{-0.9,-0.4,0.0},
-{-1.0,-0.2,0.0},
-{-0.8,0.6,-0.2},
-{-0.7,0.7,-0.2},
-{-0.7,0.7,-0.3},
-{-0.9,0.4,-0.2},
-{-0.8,0.6,-0.2},
-{-0.8,0.5,-0.4},
-{-0.9,0.4,0.0},
-{-0.8,0.6,0.0},
-{-0.8,0.6,-0.2},
-{0.2,0.8,-0.6},
-{0.0,0.8,-0.6},
-{0.0,0.9,-0.4},
-{0.4,0.8,-0.5},
-{0.2,0.8,-0.6},
-{0.2,0.9,-0.4},
-{0.3,0.7,-0.7},
-{0.2,0.7,-0.7},
-{0.2,0.8,-0.6},
-{0.2,0.9,0.4},
-{0.2,0.9,0.2},
-{0.0,1.0,0.2},
-{0.4,0.8,0.4},
-{0.4,0.9,0.2},
-{0.2,0.9,0.2},
-{0.4,0.9,0.2},
-{0.4,0.9,0.0},
-{0.2,1.0,0.0},
-{-0.6,0.8,0.2},
-{-0.7,0.7,0.2},
-{-0.7,0.7,0.3},
-{-0.4,0.9,0.2},
-{-0.6,0.8,0.2},
-{-0.5,0.8,0.4},
-{-0.4,0.9,0.0},
-{-0.6,0.8,0.0},
-{-0.6,0.8,0.2},
-{-0.5,0.8,-0.4},
-{-0.5,0.7,-0.5},
-{-0.6,0.6,-0.5},
-{-0.4,0.8,-0.4},
-{-0.4,0.8,-0.5},
-{-0.5,0.7,-0.5},
-{-0.4,0.8,-0.5},
-{-0.3,0.7,-0.7},
-{-0.5,0.6,-0.6},
-{-0.8,0.5,0.4},
-{-0.7,0.5,0.5},
-{-0.6,0.6,0.5},
-{-0.8,0.4,0.4},
-{-0.8,0.4,0.5},
-{-0.7,0.5,0.5},
-{-0.8,0.4,0.5},
-{-0.7,0.3,0.7},
-{-0.6,0.5,0.6},
-{-0.5,-0.8,0.4},
-{-0.5,-0.7,0.5},
-{-0.6,-0.6,0.5},
-{-0.4,-0.8,0.4},
-{-0.4,-0.8,0.5},
-{-0.5,-0.7,0.5},
-{-0.4,-0.8,0.5},
-{-0.3,-0.7,0.7},
-{-0.5,-0.6,0.6},
-{0.8,-0.5,0.4},
-{0.7,-0.5,0.5},
-{0.6,-0.6,0.5},
-{0.8,-0.4,0.4},
-{0.8,-0.4,0.5},
-{0.7,-0.5,0.5},
-{0.8,-0.4,0.5},
-{0.7,-0.3,0.7},
-{0.6,-0.5,0.6},
-{-0.4,-0.5,0.8},
-{-0.5,-0.5,0.7},
-{-0.5,-0.6,0.6},
-{-0.4,-0.4,0.8},
-{-0.5,-0.4,0.8},
-{-0.5,-0.5,0.7},
-{-0.5,-0.4,0.8},
-{-0.7,-0.3,0.7},
-{-0.6,-0.5,0.6},
-{-0.5,-0.4,-0.8},
-{-0.5,-0.5,-0.7},
-{-0.6,-0.5,-0.6},
-{-0.4,-0.4,-0.8},
-{-0.4,-0.5,-0.8},
-{-0.5,-0.5,-0.7},
-{-0.4,-0.5,-0.8},
-{-0.3,-0.7,-0.7},
-{-0.5,-0.6,-0.6},
-{-0.6,-0.5,-0.6},
-{-0.5,-0.5,-0.7},
-{-0.6,-0.6,-0.6},
-{-0.5,-0.6,0.6},
-{-0.5,-0.5,0.7},
-{-0.6,-0.6,0.6},
-{0.6,-0.6,0.5},
-{0.7,-0.5,0.5},
-{0.6,-0.6,0.6},
-{-0.6,-0.6,0.5},
-{-0.5,-0.7,0.5},
-{-0.6,-0.6,0.6},
-{-0.6,0.6,0.5},
-{-0.7,0.5,0.5},
-{-0.6,0.6,0.6},
-{-0.6,0.6,-0.5},
-{-0.5,0.7,-0.5},
-{-0.6,0.6,-0.6},
-{-0.6,0.8,0.2},
-{-0.6,0.8,0.0},
-{-0.7,0.7,0.2},
-{0.0,1.0,0.2},
-{0.2,0.9,0.2},
-{0.0,1.0,0.0},
-{0.2,0.8,-0.6},
-{0.2,0.7,-0.7},
-{0.0,0.8,-0.6},
-{-0.8,0.6,-0.2},
-{-0.8,0.6,0.0},
-{-0.7,0.7,-0.2},
-{-1.0,0.0,-0.2},
-{-0.9,-0.2,-0.2},
-{-1.0,0.0,0.0},
-{-0.8,-0.2,0.6},
-{-0.7,-0.2,0.7},
-{-0.8,0.0,0.6},
-{-0.6,-0.8,-0.2},
-{-0.6,-0.8,0.0},
-{-0.7,-0.7,-0.2},
-{0.0,-1.0,-0.2},
-{0.2,-0.9,-0.2},
-{0.0,-1.0,0.0},
-{0.2,-0.8,0.6},
-{0.2,-0.7,0.7},
-{0.0,-0.8,0.6},
-{0.8,-0.6,-0.2},
-{0.8,-0.6,0.0},
-{0.7,-0.7,-0.2},
-{1.0,0.0,-0.2},
-{0.9,0.2,-0.2},
-{1.0,0.0,0.0},
-{0.8,0.2,0.6},
-{0.7,0.2,0.7},
-{0.8,0.0,0.6},
-{0.2,-0.6,0.8},
-{0.0,-0.6,0.8},
-{0.2,-0.7,0.7},
-{0.2,0.0,1.0},
-{0.2,0.2,0.9},
-{0.0,0.0,1.0},
-{-0.6,0.2,0.8},
-{-0.7,0.2,0.7},
-{-0.6,0.0,0.8},
-{-0.6,0.2,-0.8},
-{-0.6,0.0,-0.8},
-{-0.7,0.2,-0.7},
-{0.0,0.2,-1.0},
-{0.2,0.2,-0.9},
-{0.0,0.0,-1.0},
-{0.2,-0.6,-0.8},
-{0.2,-0.7,-0.7},
-{0.0,-0.6,-0.8},
-{0.2,-0.2,-0.9},
-{0.2,-0.4,-0.9},
-{0.0,-0.2,-1.0},
-{0.6,-0.2,-0.8},
-{0.5,-0.4,-0.8},
-{0.4,-0.2,-0.9},
-{0.5,-0.5,-0.7},
-{0.5,-0.6,-0.6},
-{0.4,-0.5,-0.8},
-{0.0,0.6,-0.8},
-{0.2,0.6,-0.8},
-{0.0,0.4,-0.9},
-{0.4,0.5,-0.8},
-{0.5,0.5,-0.7},
-{0.4,0.4,-0.8},
-{0.4,0.2,-0.9},
-{0.6,0.2,-0.8},
-{0.4,0.0,-0.9},
-{-0.5,0.5,-0.7},
-{-0.5,0.4,-0.8},
-{-0.6,0.5,-0.6},
-{-0.2,0.6,-0.8},
-{-0.2,0.4,-0.9},
-{-0.4,0.5,-0.8},
-{-0.2,0.2,-0.9},
-{-0.2,0.0,-1.0},
-{-0.4,0.2,-0.9},
-{-0.2,0.2,0.9},
-{-0.4,0.2,0.9},
-{-0.2,0.0,1.0},
-{-0.2,0.6,0.8},
-{-0.4,0.5,0.8},
-{-0.2,0.4,0.9},
-{-0.5,0.5,0.7},
-{-0.6,0.5,0.6},
-{-0.5,0.4,0.8},
-{0.6,0.0,0.8},
-{0.6,0.2,0.8},
-{0.4,0.0,0.9},
-{0.5,0.4,0.8},
-{0.5,0.5,0.7},
-{0.4,0.4,0.8},
-{0.2,0.4,0.9},
-{0.2,0.6,0.8},
-{0.0,0.4,0.9},
-{0.5,-0.5,0.7},
-{0.4,-0.5,0.8},
-{0.5,-0.6,0.6},
-{0.6,-0.2,0.8},
-{0.4,-0.2,0.9},
-{0.5,-0.4,0.8},
-{0.2,-0.2,0.9},
-{0.0,-0.2,1.0},
-{0.2,-0.4,0.9},
-{0.9,0.2,0.2},
-{0.9,0.2,0.4},
-{1.0,0.0,0.2},
-{0.8,0.6,0.2},
-{0.8,0.5,0.4},
-{0.9,0.4,0.2},
-{0.7,0.5,0.5},
-{0.6,0.5,0.6},
-{0.8,0.4,0.5},
-{0.8,0.0,-0.6},
-{0.8,0.2,-0.6},
-{0.9,0.0,-0.4},
-{0.8,0.4,-0.5},
-{0.7,0.5,-0.5},
-{0.8,0.4,-0.4},
-{0.9,0.4,-0.2},
-{0.8,0.6,-0.2},
-{0.9,0.4,0.0},
-{0.7,-0.5,-0.5},
-{0.8,-0.5,-0.4},
-{0.6,-0.6,-0.5},
-{0.8,-0.2,-0.6},
-{0.9,-0.2,-0.4},
-{0.8,-0.4,-0.5},
-{0.9,-0.2,-0.2},
-{1.0,-0.2,0.0},
-{0.9,-0.4,-0.2},
-{0.2,-0.9,0.2},
-{0.2,-0.9,0.4},
-{0.0,-1.0,0.2},
-{0.6,-0.8,0.2},
-{0.5,-0.8,0.4},
-{0.4,-0.9,0.2},
-{0.5,-0.7,0.5},
-{0.5,-0.6,0.6},
-{0.4,-0.8,0.5},
-{0.0,-0.8,-0.6},
-{0.2,-0.8,-0.6},
-{0.0,-0.9,-0.4},
-{0.4,-0.8,-0.5},
-{0.5,-0.7,-0.5},
-{0.4,-0.8,-0.4},
-{0.4,-0.9,-0.2},
-{0.6,-0.8,-0.2},
-{0.4,-0.9,0.0},
-{-0.5,-0.7,-0.5},
-{-0.5,-0.8,-0.4},
-{-0.6,-0.6,-0.5},
-{-0.2,-0.8,-0.6},
-{-0.2,-0.9,-0.4},
-{-0.4,-0.8,-0.5},
-{-0.2,-0.9,-0.2},
-{-0.2,-1.0,0.0},
-{-0.4,-0.9,-0.2},
-{-0.9,-0.2,0.2},
-{-0.9,-0.2,0.4},
-{-1.0,0.0,0.2},
-{-0.8,-0.6,0.2},
-{-0.8,-0.5,0.4},
-{-0.9,-0.4,0.2},
-{-0.7,-0.5,0.5},
-{-0.6,-0.5,0.6},
-{-0.8,-0.4,0.5},
-{-0.8,0.0,-0.6},
-{-0.8,-0.2,-0.6},
-{-0.9,0.0,-0.4},
-{-0.8,-0.4,-0.5},
-{-0.7,-0.5,-0.5},
-{-0.8,-0.4,-0.4},
-{-0.9,-0.4,-0.2},
-{-0.8,-0.6,-0.2},
-{-0.9,-0.4,0.0},
-{-0.7,0.5,-0.5},
-{-0.8,0.5,-0.4},
-{-0.6,0.6,-0.5},
-{-0.8,0.2,-0.6},
-{-0.9,0.2,-0.4},
-{-0.8,0.4,-0.5},
-{-0.9,0.2,-0.2},
-{-1.0,0.2,0.0},
-{-0.9,0.4,-0.2},
-{0.2,0.9,-0.2},
-{0.2,0.9,-0.4},
-{0.0,1.0,-0.2},
-{0.6,0.8,-0.2},
-{0.5,0.8,-0.4},
-{0.4,0.9,-0.2},
-{0.5,0.7,-0.5},
-{0.5,0.6,-0.6},
-{0.4,0.8,-0.5},
-{0.0,0.8,0.6},
-{0.2,0.8,0.6},
-{0.0,0.9,0.4},
-{0.4,0.8,0.5},
-{0.5,0.7,0.5},
-{0.4,0.8,0.4},
-{0.4,0.9,0.2},
-{0.6,0.8,0.2},
-{0.4,0.9,0.0},
-{-0.5,0.7,0.5},
-{-0.5,0.8,0.4},
-{-0.6,0.6,0.5},
-{-0.2,0.8,0.6},
-{-0.2,0.9,0.4},
-{-0.4,0.8,0.5},
-{-0.2,0.9,0.2},
-{-0.2,1.0,0.0},
-{-0.4,0.9,0.2},
-{-0.7,0.7,-0.2},
-{-0.6,0.8,-0.2},
-{-0.7,0.7,-0.3},
-{-0.4,0.9,-0.2},
-{-0.2,0.9,-0.2},
-{-0.4,0.8,-0.4},
-{-0.4,0.8,-0.5},
-{-0.2,0.8,-0.6},
-{-0.3,0.7,-0.7},
-{-0.7,0.7,0.2},
-{-0.8,0.6,0.2},
-{-0.7,0.7,0.3},
-{-0.9,0.4,0.2},
-{-0.9,0.2,0.2},
-{-0.8,0.4,0.4},
-{-0.8,0.4,0.5},
-{-0.8,0.2,0.6},
-{-0.7,0.3,0.7},
-{-0.7,-0.7,0.2},
-{-0.6,-0.8,0.2},
-{-0.7,-0.7,0.3},
-{-0.4,-0.9,0.2},
-{-0.2,-0.9,0.2},
-{-0.4,-0.8,0.4},
-{-0.4,-0.8,0.5},
-{-0.2,-0.8,0.6},
-{-0.3,-0.7,0.7},
-{0.7,-0.7,0.2},
-{0.8,-0.6,0.2},
-{0.7,-0.7,0.3},
-{0.9,-0.4,0.2},
-{0.9,-0.2,0.2},
-{0.8,-0.4,0.4},
-{0.8,-0.4,0.5},
-{0.8,-0.2,0.6},
-{0.7,-0.3,0.7},
-{-0.2,-0.7,0.7},
-{-0.2,-0.6,0.8},
-{-0.3,-0.7,0.7},
-{-0.2,-0.4,0.9},
-{-0.2,-0.2,0.9},
-{-0.4,-0.4,0.8},
-{-0.5,-0.4,0.8},
-{-0.6,-0.2,0.8},
-{-0.7,-0.3,0.7},
-{-0.7,-0.2,-0.7},
-{-0.6,-0.2,-0.8},
-{-0.7,-0.3,-0.7},
-{-0.4,-0.2,-0.9},
-{-0.2,-0.2,-0.9},
-{-0.4,-0.4,-0.8},
-{-0.4,-0.5,-0.8},
-{-0.2,-0.6,-0.8},
-{-0.3,-0.7,-0.7},
-{-0.4,-0.4,-0.8},
-{-0.2,-0.4,-0.9},
-{-0.4,-0.5,-0.8},
-{-0.2,-0.4,-0.9},
-{0.0,-0.4,-0.9},
-{-0.2,-0.6,-0.8},
-{-0.2,-0.6,-0.8},
-{0.0,-0.6,-0.8},
-{-0.2,-0.7,-0.7},
-{-0.4,0.0,-0.9},
-{-0.2,0.0,-1.0},
-{-0.4,-0.2,-0.9},
-{-0.2,0.0,-1.0},
-{0.0,0.0,-1.0},
-{-0.2,-0.2,-0.9},
-{-0.2,-0.2,-0.9},
-{0.0,-0.2,-1.0},
-{-0.2,-0.4,-0.9},
-{-0.7,0.0,-0.7},
-{-0.6,0.0,-0.8},
-{-0.7,-0.2,-0.7},
-{-0.6,0.0,-0.8},
-{-0.4,0.0,-0.9},
-{-0.6,-0.2,-0.8},
-{-0.6,-0.2,-0.8},
-{-0.4,-0.2,-0.9},
-{-0.5,-0.4,-0.8},
-{-0.4,-0.4,0.8},
-{-0.4,-0.2,0.9},
-{-0.5,-0.4,0.8},
-{-0.4,-0.2,0.9},
-{-0.4,0.0,0.9},
-{-0.6,-0.2,0.8},
-{-0.6,-0.2,0.8},
-{-0.6,0.0,0.8},
-{-0.7,-0.2,0.7},
-{0.0,-0.4,0.9},
-{0.0,-0.2,1.0},
-{-0.2,-0.4,0.9},
-{0.0,-0.2,1.0},
-{0.0,0.0,1.0},
-{-0.2,-0.2,0.9},
-{-0.2,-0.2,0.9},
-{-0.2,0.0,1.0},
-{-0.4,-0.2,0.9},
-{0.0,-0.7,0.7},
-{0.0,-0.6,0.8},
-{-0.2,-0.7,0.7},
-{0.0,-0.6,0.8},
-{0.0,-0.4,0.9},
-{-0.2,-0.6,0.8},
-{-0.2,-0.6,0.8},
-{-0.2,-0.4,0.9},
-{-0.4,-0.5,0.8},
-{0.8,-0.4,0.4},
-{0.9,-0.2,0.4},
-{0.8,-0.4,0.5},
-{0.9,-0.2,0.4},
-{0.9,0.0,0.4},
-{0.8,-0.2,0.6},
-{0.8,-0.2,0.6},
-{0.8,0.0,0.6},
-{0.7,-0.2,0.7},
-{0.9,-0.4,0.0},
-{1.0,-0.2,0.0},
-{0.9,-0.4,0.2},
-{1.0,-0.2,0.0},
-{1.0,0.0,0.0},
-{0.9,-0.2,0.2},
-{0.9,-0.2,0.2},
-{1.0,0.0,0.2},
-{0.9,-0.2,0.4},
-{0.7,-0.7,0.0},
-{0.8,-0.6,0.0},
-{0.7,-0.7,0.2},
-{0.8,-0.6,0.0},
-{0.9,-0.4,0.0},
-{0.8,-0.6,0.2},
-{0.8,-0.6,0.2},
-{0.9,-0.4,0.2},
-{0.8,-0.5,0.4},
-{-0.4,-0.8,0.4},
-{-0.2,-0.9,0.4},
-{-0.4,-0.8,0.5},
-{-0.2,-0.9,0.4},
-{0.0,-0.9,0.4},
-{-0.2,-0.8,0.6},
-{-0.2,-0.8,0.6},
-{0.0,-0.8,0.6},
-{-0.2,-0.7,0.7},
-{-0.4,-0.9,0.0},
-{-0.2,-1.0,0.0},
-{-0.4,-0.9,0.2},
-{-0.2,-1.0,0.0},
-{0.0,-1.0,0.0},
-{-0.2,-0.9,0.2},
-{-0.2,-0.9,0.2},
-{0.0,-1.0,0.2},
-{-0.2,-0.9,0.4},
-{-0.7,-0.7,0.0},
-{-0.6,-0.8,0.0},
-{-0.7,-0.7,0.2},
-{-0.6,-0.8,0.0},
-{-0.4,-0.9,0.0},
-{-0.6,-0.8,0.2},
-{-0.6,-0.8,0.2},
-{-0.4,-0.9,0.2},
-{-0.5,-0.8,0.4},
-{-0.8,0.4,0.4},
-{-0.9,0.2,0.4},
-{-0.8,0.4,0.5},
-{-0.9,0.2,0.4},
-{-0.9,0.0,0.4},
-{-0.8,0.2,0.6},
-{-0.8,0.2,0.6},
-{-0.8,0.0,0.6},
-{-0.7,0.2,0.7},
-{-0.9,0.4,0.0},
-{-1.0,0.2,0.0},
-{-0.9,0.4,0.2},
-{-1.0,0.2,0.0},
-{-1.0,0.0,0.0},
-{-0.9,0.2,0.2},
-{-0.9,0.2,0.2},
-{-1.0,0.0,0.2},
-{-0.9,0.2,0.4},
-{-0.7,0.7,0.0},
-{-0.8,0.6,0.0},
-{-0.7,0.7,0.2},
-{-0.8,0.6,0.0},
-{-0.9,0.4,0.0},
-{-0.8,0.6,0.2},
-{-0.8,0.6,0.2},
-{-0.9,0.4,0.2},
-{-0.8,0.5,0.4},
-{-0.4,0.8,-0.4},
-{-0.2,0.9,-0.4},
-{-0.4,0.8,-0.5},
-{-0.2,0.9,-0.4},
-{0.0,0.9,-0.4},
-{-0.2,0.8,-0.6},
-{-0.2,0.8,-0.6},
-{0.0,0.8,-0.6},
-{-0.2,0.7,-0.7},
-{-0.4,0.9,0.0},
-{-0.2,1.0,0.0},
-{-0.4,0.9,-0.2},
-{-0.2,1.0,0.0},
-{0.0,1.0,0.0},
-{-0.2,0.9,-0.2},
-{-0.2,0.9,-0.2},
-{0.0,1.0,-0.2},
-{-0.2,0.9,-0.4},
-{-0.7,0.7,0.0},
-{-0.6,0.8,0.0},
-{-0.7,0.7,-0.2},
-{-0.6,0.8,0.0},
-{-0.4,0.9,0.0},
-{-0.6,0.8,-0.2},
-{-0.6,0.8,-0.2},
-{-0.4,0.9,-0.2},
-{-0.5,0.8,-0.4},
-{-0.2,0.9,0.4},
-{-0.2,0.9,0.2},
-{-0.4,0.8,0.4},
-{0.0,0.9,0.4},
-{0.0,1.0,0.2},
-{-0.2,0.9,0.4},
-{0.0,1.0,0.2},
-{0.0,1.0,0.0},
-{-0.2,0.9,0.2},
-{-0.2,0.7,0.7},
-{-0.2,0.8,0.6},
-{-0.3,0.7,0.7},
-{0.0,0.7,0.7},
-{0.0,0.8,0.6},
-{-0.2,0.7,0.7},
-{0.0,0.8,0.6},
-{0.0,0.9,0.4},
-{-0.2,0.8,0.6},
-{-0.5,0.6,0.6},
-{-0.5,0.7,0.5},
-{-0.6,0.6,0.6},
-{-0.3,0.7,0.7},
-{-0.4,0.8,0.5},
-{-0.5,0.6,0.6},
-{-0.4,0.8,0.5},
-{-0.4,0.8,0.4},
-{-0.5,0.7,0.5},
-{0.4,0.8,0.4},
-{0.5,0.8,0.4},
-{0.4,0.9,0.2},
-{0.5,0.8,0.4},
-{0.7,0.7,0.3},
-{0.6,0.8,0.2},
-{0.6,0.8,0.2},
-{0.7,0.7,0.2},
-{0.6,0.8,0.0},
-{0.3,0.7,0.7},
-{0.5,0.6,0.6},
-{0.4,0.8,0.5},
-{0.5,0.6,0.6},
-{0.6,0.6,0.6},
-{0.5,0.7,0.5},
-{0.5,0.7,0.5},
-{0.6,0.6,0.5},
-{0.5,0.8,0.4},
-{0.0,0.7,0.7},
-{0.2,0.7,0.7},
-{0.0,0.8,0.6},
-{0.2,0.7,0.7},
-{0.3,0.7,0.7},
-{0.2,0.8,0.6},
-{0.2,0.8,0.6},
-{0.4,0.8,0.5},
-{0.2,0.9,0.4},
-{0.5,0.8,-0.4},
-{0.5,0.7,-0.5},
-{0.4,0.8,-0.4},
-{0.7,0.7,-0.3},
-{0.6,0.6,-0.5},
-{0.5,0.8,-0.4},
-{0.6,0.6,-0.5},
-{0.6,0.6,-0.6},
-{0.5,0.7,-0.5},
-{0.6,0.8,0.0},
-{0.6,0.8,-0.2},
-{0.4,0.9,0.0},
-{0.7,0.7,0.0},
-{0.7,0.7,-0.2},
-{0.6,0.8,0.0},
-{0.7,0.7,-0.2},
-{0.7,0.7,-0.3},
-{0.6,0.8,-0.2},
-{0.2,1.0,0.0},
-{0.2,0.9,-0.2},
-{0.0,1.0,0.0},
-{0.4,0.9,0.0},
-{0.4,0.9,-0.2},
-{0.2,1.0,0.0},
-{0.4,0.9,-0.2},
-{0.4,0.8,-0.4},
-{0.2,0.9,-0.2},
-{-0.9,0.2,-0.4},
-{-0.9,0.2,-0.2},
-{-0.8,0.4,-0.4},
-{-0.9,0.0,-0.4},
-{-1.0,0.0,-0.2},
-{-0.9,0.2,-0.4},
-{-1.0,0.0,-0.2},
-{-1.0,0.0,0.0},
-{-0.9,0.2,-0.2},
-{-0.7,0.2,-0.7},
-{-0.8,0.2,-0.6},
-{-0.7,0.3,-0.7},
-{-0.7,0.0,-0.7},
-{-0.8,0.0,-0.6},
-{-0.7,0.2,-0.7},
-{-0.8,0.0,-0.6},
-{-0.9,0.0,-0.4},
-{-0.8,0.2,-0.6},
-{-0.6,0.5,-0.6},
-{-0.7,0.5,-0.5},
-{-0.6,0.6,-0.6},
-{-0.7,0.3,-0.7},
-{-0.8,0.4,-0.5},
-{-0.6,0.5,-0.6},
-{-0.8,0.4,-0.5},
-{-0.8,0.4,-0.4},
-{-0.7,0.5,-0.5},
-{-0.8,-0.4,-0.4},
-{-0.8,-0.5,-0.4},
-{-0.9,-0.4,-0.2},
-{-0.8,-0.5,-0.4},
-{-0.7,-0.7,-0.3},
-{-0.8,-0.6,-0.2},
-{-0.8,-0.6,-0.2},
-{-0.7,-0.7,-0.2},
-{-0.8,-0.6,0.0},
-{-0.7,-0.3,-0.7},
-{-0.6,-0.5,-0.6},
-{-0.8,-0.4,-0.5},
-{-0.6,-0.5,-0.6},
-{-0.6,-0.6,-0.6},
-{-0.7,-0.5,-0.5},
-{-0.7,-0.5,-0.5},
-{-0.6,-0.6,-0.5},
-{-0.8,-0.5,-0.4},
-{-0.7,0.0,-0.7},
-{-0.7,-0.2,-0.7},
-{-0.8,0.0,-0.6},
-{-0.7,-0.2,-0.7},
-{-0.7,-0.3,-0.7},
-{-0.8,-0.2,-0.6},
-{-0.8,-0.2,-0.6},
-{-0.8,-0.4,-0.5},
-{-0.9,-0.2,-0.4},
-{-0.8,-0.5,0.4},
-{-0.7,-0.5,0.5},
-{-0.8,-0.4,0.4},
-{-0.7,-0.7,0.3},
-{-0.6,-0.6,0.5},
-{-0.8,-0.5,0.4},
-{-0.6,-0.6,0.5},
-{-0.6,-0.6,0.6},
-{-0.7,-0.5,0.5},
-{-0.8,-0.6,0.0},
-{-0.8,-0.6,0.2},
-{-0.9,-0.4,0.0},
-{-0.7,-0.7,0.0},
-{-0.7,-0.7,0.2},
-{-0.8,-0.6,0.0},
-{-0.7,-0.7,0.2},
-{-0.7,-0.7,0.3},
-{-0.8,-0.6,0.2},
-{-1.0,-0.2,0.0},
-{-0.9,-0.2,0.2},
-{-1.0,0.0,0.0},
-{-0.9,-0.4,0.0},
-{-0.9,-0.4,0.2},
-{-1.0,-0.2,0.0},
-{-0.9,-0.4,0.2},
-{-0.8,-0.4,0.4},
-{-0.9,-0.2,0.2},
-{-0.2,-0.9,-0.4},
-{-0.2,-0.9,-0.2},
-{-0.4,-0.8,-0.4},
-{0.0,-0.9,-0.4},
-{0.0,-1.0,-0.2},
-{-0.2,-0.9,-0.4},
-{0.0,-1.0,-0.2},
-{0.0,-1.0,0.0},
-{-0.2,-0.9,-0.2},
-{-0.2,-0.7,-0.7},
-{-0.2,-0.8,-0.6},
-{-0.3,-0.7,-0.7},
-{0.0,-0.7,-0.7},
-{0.0,-0.8,-0.6},
-{-0.2,-0.7,-0.7},
-{0.0,-0.8,-0.6},
-{0.0,-0.9,-0.4},
-{-0.2,-0.8,-0.6},
-{-0.5,-0.6,-0.6},
-{-0.5,-0.7,-0.5},
-{-0.6,-0.6,-0.6},
-{-0.3,-0.7,-0.7},
-{-0.4,-0.8,-0.5},
-{-0.5,-0.6,-0.6},
-{-0.4,-0.8,-0.5},
-{-0.4,-0.8,-0.4},
-{-0.5,-0.7,-0.5},
-{0.4,-0.8,-0.4},
-{0.5,-0.8,-0.4},
-{0.4,-0.9,-0.2},
-{0.5,-0.8,-0.4},
-{0.7,-0.7,-0.3},
-{0.6,-0.8,-0.2},
-{0.6,-0.8,-0.2},
-{0.7,-0.7,-0.2},
-{0.6,-0.8,0.0},
-{0.3,-0.7,-0.7},
-{0.5,-0.6,-0.6},
-{0.4,-0.8,-0.5},
-{0.5,-0.6,-0.6},
-{0.6,-0.6,-0.6},
-{0.5,-0.7,-0.5},
-{0.5,-0.7,-0.5},
-{0.6,-0.6,-0.5},
-{0.5,-0.8,-0.4},
-{0.0,-0.7,-0.7},
-{0.2,-0.7,-0.7},
-{0.0,-0.8,-0.6},
-{0.2,-0.7,-0.7},
-{0.3,-0.7,-0.7},
-{0.2,-0.8,-0.6},
-{0.2,-0.8,-0.6},
-{0.4,-0.8,-0.5},
-{0.2,-0.9,-0.4},
-{0.5,-0.8,0.4},
-{0.5,-0.7,0.5},
-{0.4,-0.8,0.4},
-{0.7,-0.7,0.3},
-{0.6,-0.6,0.5},
-{0.5,-0.8,0.4},
-{0.6,-0.6,0.5},
-{0.6,-0.6,0.6},
-{0.5,-0.7,0.5},
-{0.6,-0.8,0.0},
-{0.6,-0.8,0.2},
-{0.4,-0.9,0.0},
-{0.7,-0.7,0.0},
-{0.7,-0.7,0.2},
-{0.6,-0.8,0.0},
-{0.7,-0.7,0.2},
-{0.7,-0.7,0.3},
-{0.6,-0.8,0.2},
-{0.2,-1.0,0.0},
-{0.2,-0.9,0.2},
-{0.0,-1.0,0.0},
-{0.4,-0.9,0.0},
-{0.4,-0.9,0.2},
-{0.2,-1.0,0.0},
-{0.4,-0.9,0.2},
-{0.4,-0.8,0.4},
-{0.2,-0.9,0.2},
-{0.9,-0.2,-0.4},
-{0.9,-0.2,-0.2},
-{0.8,-0.4,-0.4},
-{0.9,0.0,-0.4},
-{1.0,0.0,-0.2},
-{0.9,-0.2,-0.4},
-{1.0,0.0,-0.2},
-{1.0,0.0,0.0},
-{0.9,-0.2,-0.2},
-{0.7,-0.2,-0.7},
-{0.8,-0.2,-0.6},
-{0.7,-0.3,-0.7},
-{0.7,0.0,-0.7},
-{0.8,0.0,-0.6},
-{0.7,-0.2,-0.7},
-{0.8,0.0,-0.6},
-{0.9,0.0,-0.4},
-{0.8,-0.2,-0.6},
-{0.6,-0.5,-0.6},
-{0.7,-0.5,-0.5},
-{0.6,-0.6,-0.6},
-{0.7,-0.3,-0.7},
-{0.8,-0.4,-0.5},
-{0.6,-0.5,-0.6},
-{0.8,-0.4,-0.5},
-{0.8,-0.4,-0.4},
-{0.7,-0.5,-0.5},
-{0.8,0.4,-0.4},
-{0.8,0.5,-0.4},
-{0.9,0.4,-0.2},
-{0.8,0.5,-0.4},
-{0.7,0.7,-0.3},
-{0.8,0.6,-0.2},
-{0.8,0.6,-0.2},
-{0.7,0.7,-0.2},
-{0.8,0.6,0.0},
-{0.7,0.3,-0.7},
-{0.6,0.5,-0.6},
-{0.8,0.4,-0.5},
-{0.6,0.5,-0.6},
-{0.6,0.6,-0.6},
-{0.7,0.5,-0.5},
-{0.7,0.5,-0.5},
-{0.6,0.6,-0.5},
-{0.8,0.5,-0.4},
-{0.7,0.0,-0.7},
-{0.7,0.2,-0.7},
-{0.8,0.0,-0.6},
-{0.7,0.2,-0.7},
-{0.7,0.3,-0.7},
-{0.8,0.2,-0.6},
-{0.8,0.2,-0.6},
-{0.8,0.4,-0.5},
-{0.9,0.2,-0.4},
-{0.8,0.5,0.4},
-{0.7,0.5,0.5},
-{0.8,0.4,0.4},
-{0.7,0.7,0.3},
-{0.6,0.6,0.5},
-{0.8,0.5,0.4},
-{0.6,0.6,0.5},
-{0.6,0.6,0.6},
-{0.7,0.5,0.5},
-{0.8,0.6,0.0},
-{0.8,0.6,0.2},
-{0.9,0.4,0.0},
-{0.7,0.7,0.0},
-{0.7,0.7,0.2},
-{0.8,0.6,0.0},
-{0.7,0.7,0.2},
-{0.7,0.7,0.3},
-{0.8,0.6,0.2},
-{1.0,0.2,0.0},
-{0.9,0.2,0.2},
-{1.0,0.0,0.0},
-{0.9,0.4,0.0},
-{0.9,0.4,0.2},
-{1.0,0.2,0.0},
-{0.9,0.4,0.2},
-{0.8,0.4,0.4},
-{0.9,0.2,0.2},
-{0.4,-0.2,0.9},
-{0.2,-0.2,0.9},
-{0.4,-0.4,0.8},
-{0.4,0.0,0.9},
-{0.2,0.0,1.0},
-{0.4,-0.2,0.9},
-{0.2,0.0,1.0},
-{0.0,0.0,1.0},
-{0.2,-0.2,0.9},
-{0.7,-0.2,0.7},
-{0.6,-0.2,0.8},
-{0.7,-0.3,0.7},
-{0.7,0.0,0.7},
-{0.6,0.0,0.8},
-{0.7,-0.2,0.7},
-{0.6,0.0,0.8},
-{0.4,0.0,0.9},
-{0.6,-0.2,0.8},
-{0.6,-0.5,0.6},
-{0.5,-0.5,0.7},
-{0.6,-0.6,0.6},
-{0.7,-0.3,0.7},
-{0.5,-0.4,0.8},
-{0.6,-0.5,0.6},
-{0.5,-0.4,0.8},
-{0.4,-0.4,0.8},
-{0.5,-0.5,0.7},
-{0.4,0.4,0.8},
-{0.4,0.5,0.8},
-{0.2,0.4,0.9},
-{0.4,0.5,0.8},
-{0.3,0.7,0.7},
-{0.2,0.6,0.8},
-{0.2,0.6,0.8},
-{0.2,0.7,0.7},
-{0.0,0.6,0.8},
-{0.7,0.3,0.7},
-{0.6,0.5,0.6},
-{0.5,0.4,0.8},
-{0.6,0.5,0.6},
-{0.6,0.6,0.6},
-{0.5,0.5,0.7},
-{0.5,0.5,0.7},
-{0.5,0.6,0.6},
-{0.4,0.5,0.8},
-{0.7,0.0,0.7},
-{0.7,0.2,0.7},
-{0.6,0.0,0.8},
-{0.7,0.2,0.7},
-{0.7,0.3,0.7},
-{0.6,0.2,0.8},
-{0.6,0.2,0.8},
-{0.5,0.4,0.8},
-{0.4,0.2,0.9},
-{-0.4,0.5,0.8},
-{-0.5,0.5,0.7},
-{-0.4,0.4,0.8},
-{-0.3,0.7,0.7},
-{-0.5,0.6,0.6},
-{-0.4,0.5,0.8},
-{-0.5,0.6,0.6},
-{-0.6,0.6,0.6},
-{-0.5,0.5,0.7},
-{0.0,0.6,0.8},
-{-0.2,0.6,0.8},
-{0.0,0.4,0.9},
-{0.0,0.7,0.7},
-{-0.2,0.7,0.7},
-{0.0,0.6,0.8},
-{-0.2,0.7,0.7},
-{-0.3,0.7,0.7},
-{-0.2,0.6,0.8},
-{0.0,0.2,1.0},
-{-0.2,0.2,0.9},
-{0.0,0.0,1.0},
-{0.0,0.4,0.9},
-{-0.2,0.4,0.9},
-{0.0,0.2,1.0},
-{-0.2,0.4,0.9},
-{-0.4,0.4,0.8},
-{-0.2,0.2,0.9},
-{-0.2,0.4,-0.9},
-{-0.2,0.2,-0.9},
-{-0.4,0.4,-0.8},
-{0.0,0.4,-0.9},
-{0.0,0.2,-1.0},
-{-0.2,0.4,-0.9},
-{0.0,0.2,-1.0},
-{0.0,0.0,-1.0},
-{-0.2,0.2,-0.9},
-{-0.2,0.7,-0.7},
-{-0.2,0.6,-0.8},
-{-0.3,0.7,-0.7},
-{0.0,0.7,-0.7},
-{0.0,0.6,-0.8},
-{-0.2,0.7,-0.7},
-{0.0,0.6,-0.8},
-{0.0,0.4,-0.9},
-{-0.2,0.6,-0.8},
-{-0.5,0.6,-0.6},
-{-0.5,0.5,-0.7},
-{-0.6,0.6,-0.6},
-{-0.3,0.7,-0.7},
-{-0.4,0.5,-0.8},
-{-0.5,0.6,-0.6},
-{-0.4,0.5,-0.8},
-{-0.4,0.4,-0.8},
-{-0.5,0.5,-0.7},
-{0.4,0.4,-0.8},
-{0.5,0.4,-0.8},
-{0.4,0.2,-0.9},
-{0.5,0.4,-0.8},
-{0.7,0.3,-0.7},
-{0.6,0.2,-0.8},
-{0.6,0.2,-0.8},
-{0.7,0.2,-0.7},
-{0.6,0.0,-0.8},
-{0.3,0.7,-0.7},
-{0.5,0.6,-0.6},
-{0.4,0.5,-0.8},
-{0.5,0.6,-0.6},
-{0.6,0.6,-0.6},
-{0.5,0.5,-0.7},
-{0.5,0.5,-0.7},
-{0.6,0.5,-0.6},
-{0.5,0.4,-0.8},
-{0.0,0.7,-0.7},
-{0.2,0.7,-0.7},
-{0.0,0.6,-0.8},
-{0.2,0.7,-0.7},
-{0.3,0.7,-0.7},
-{0.2,0.6,-0.8},
-{0.2,0.6,-0.8},
-{0.4,0.5,-0.8},
-{0.2,0.4,-0.9},
-{0.5,-0.4,-0.8},
-{0.5,-0.5,-0.7},
-{0.4,-0.4,-0.8},
-{0.7,-0.3,-0.7},
-{0.6,-0.5,-0.6},
-{0.5,-0.4,-0.8},
-{0.6,-0.5,-0.6},
-{0.6,-0.6,-0.6},
-{0.5,-0.5,-0.7},
-{0.6,0.0,-0.8},
-{0.6,-0.2,-0.8},
-{0.4,0.0,-0.9},
-{0.7,0.0,-0.7},
-{0.7,-0.2,-0.7},
-{0.6,0.0,-0.8},
-{0.7,-0.2,-0.7},
-{0.7,-0.3,-0.7},
-{0.6,-0.2,-0.8},
-{0.2,0.0,-1.0},
-{0.2,-0.2,-0.9},
-{0.0,0.0,-1.0},
-{0.4,0.0,-0.9},
-{0.4,-0.2,-0.9},
-{0.2,0.0,-1.0},
-{0.4,-0.2,-0.9},
-{0.4,-0.4,-0.8},
-{0.2,-0.2,-0.9},
-{0.2,-0.4,-0.9},
-{0.2,-0.6,-0.8},
-{0.0,-0.4,-0.9},
-{0.4,-0.4,-0.8},
-{0.4,-0.5,-0.8},
-{0.2,-0.4,-0.9},
-{0.4,-0.5,-0.8},
-{0.3,-0.7,-0.7},
-{0.2,-0.6,-0.8},
-{0.0,0.4,-0.9},
-{0.2,0.4,-0.9},
-{0.0,0.2,-1.0},
-{0.2,0.4,-0.9},
-{0.4,0.4,-0.8},
-{0.2,0.2,-0.9},
-{0.2,0.2,-0.9},
-{0.4,0.2,-0.9},
-{0.2,0.0,-1.0},
-{-0.5,0.4,-0.8},
-{-0.6,0.2,-0.8},
-{-0.7,0.3,-0.7},
-{-0.4,0.4,-0.8},
-{-0.4,0.2,-0.9},
-{-0.5,0.4,-0.8},
-{-0.4,0.2,-0.9},
-{-0.4,0.0,-0.9},
-{-0.6,0.2,-0.8},
-{-0.4,0.2,0.9},
-{-0.6,0.2,0.8},
-{-0.4,0.0,0.9},
-{-0.4,0.4,0.8},
-{-0.5,0.4,0.8},
-{-0.4,0.2,0.9},
-{-0.5,0.4,0.8},
-{-0.7,0.3,0.7},
-{-0.6,0.2,0.8},
-{0.4,0.0,0.9},
-{0.4,0.2,0.9},
-{0.2,0.0,1.0},
-{0.4,0.2,0.9},
-{0.4,0.4,0.8},
-{0.2,0.2,0.9},
-{0.2,0.2,0.9},
-{0.2,0.4,0.9},
-{0.0,0.2,1.0},
-{0.4,-0.5,0.8},
-{0.2,-0.6,0.8},
-{0.3,-0.7,0.7},
-{0.4,-0.4,0.8},
-{0.2,-0.4,0.9},
-{0.4,-0.5,0.8},
-{0.2,-0.4,0.9},
-{0.0,-0.4,0.9},
-{0.2,-0.6,0.8},
-{0.9,0.2,0.4},
-{0.8,0.2,0.6},
-{0.9,0.0,0.4},
-{0.8,0.4,0.4},
-{0.8,0.4,0.5},
-{0.9,0.2,0.4},
-{0.8,0.4,0.5},
-{0.7,0.3,0.7},
-{0.8,0.2,0.6},
-{0.9,0.0,-0.4},
-{0.9,0.2,-0.4},
-{1.0,0.0,-0.2},
-{0.9,0.2,-0.4},
-{0.8,0.4,-0.4},
-{0.9,0.2,-0.2},
-{0.9,0.2,-0.2},
-{0.9,0.4,-0.2},
-{1.0,0.2,0.0},
-{0.8,-0.5,-0.4},
-{0.8,-0.6,-0.2},
-{0.7,-0.7,-0.3},
-{0.8,-0.4,-0.4},
-{0.9,-0.4,-0.2},
-{0.8,-0.5,-0.4},
-{0.9,-0.4,-0.2},
-{0.9,-0.4,0.0},
-{0.8,-0.6,-0.2},
-{0.2,-0.9,0.4},
-{0.2,-0.8,0.6},
-{0.0,-0.9,0.4},
-{0.4,-0.8,0.4},
-{0.4,-0.8,0.5},
-{0.2,-0.9,0.4},
-{0.4,-0.8,0.5},
-{0.3,-0.7,0.7},
-{0.2,-0.8,0.6},
-{0.0,-0.9,-0.4},
-{0.2,-0.9,-0.4},
-{0.0,-1.0,-0.2},
-{0.2,-0.9,-0.4},
-{0.4,-0.8,-0.4},
-{0.2,-0.9,-0.2},
-{0.2,-0.9,-0.2},
-{0.4,-0.9,-0.2},
-{0.2,-1.0,0.0},
-{-0.5,-0.8,-0.4},
-{-0.6,-0.8,-0.2},
-{-0.7,-0.7,-0.3},
-{-0.4,-0.8,-0.4},
-{-0.4,-0.9,-0.2},
-{-0.5,-0.8,-0.4},
-{-0.4,-0.9,-0.2},
-{-0.4,-0.9,0.0},
-{-0.6,-0.8,-0.2},
-{-0.9,-0.2,0.4},
-{-0.8,-0.2,0.6},
-{-0.9,0.0,0.4},
-{-0.8,-0.4,0.4},
-{-0.8,-0.4,0.5},
-{-0.9,-0.2,0.4},
-{-0.8,-0.4,0.5},
-{-0.7,-0.3,0.7},
-{-0.8,-0.2,0.6},
-{-0.9,0.0,-0.4},
-{-0.9,-0.2,-0.4},
-{-1.0,0.0,-0.2},
-{-0.9,-0.2,-0.4},
-{-0.8,-0.4,-0.4},
-{-0.9,-0.2,-0.2},
-{-0.9,-0.2,-0.2},
-{-0.9,-0.4,-0.2},
-{-1.0,-0.2,0.0},
-{-0.8,0.5,-0.4},
-{-0.8,0.6,-0.2},
-{-0.7,0.7,-0.3},
-{-0.8,0.4,-0.4},
-{-0.9,0.4,-0.2},
-{-0.8,0.5,-0.4},
-{-0.9,0.4,-0.2},
-{-0.9,0.4,0.0},
-{-0.8,0.6,-0.2},
-{0.2,0.9,-0.4},
-{0.2,0.8,-0.6},
-{0.0,0.9,-0.4},
-{0.4,0.8,-0.4},
-{0.4,0.8,-0.5},
-{0.2,0.9,-0.4},
-{0.4,0.8,-0.5},
-{0.3,0.7,-0.7},
-{0.2,0.8,-0.6},
-{0.0,0.9,0.4},
-{0.2,0.9,0.4},
-{0.0,1.0,0.2},
-{0.2,0.9,0.4},
-{0.4,0.8,0.4},
-{0.2,0.9,0.2},
-{0.2,0.9,0.2},
-{0.4,0.9,0.2},
-{0.2,1.0,0.0},
-{-0.5,0.8,0.4},
-{-0.6,0.8,0.2},
-{-0.7,0.7,0.3},
-{-0.4,0.8,0.4},
-{-0.4,0.9,0.2},
-{-0.5,0.8,0.4},
-{-0.4,0.9,0.2},
-{-0.4,0.9,0.0},
-{-0.6,0.8,0.2},
-{-0.7,0.7,-0.3},
-{-0.5,0.8,-0.4},
-{-0.6,0.6,-0.5},
-{-0.5,0.8,-0.4},
-{-0.4,0.8,-0.4},
-{-0.5,0.7,-0.5},
-{-0.5,0.7,-0.5},
-{-0.4,0.8,-0.5},
-{-0.5,0.6,-0.6},
-{-0.7,0.7,0.3},
-{-0.8,0.5,0.4},
-{-0.6,0.6,0.5},
-{-0.8,0.5,0.4},
-{-0.8,0.4,0.4},
-{-0.7,0.5,0.5},
-{-0.7,0.5,0.5},
-{-0.8,0.4,0.5},
-{-0.6,0.5,0.6},
-{-0.7,-0.7,0.3},
-{-0.5,-0.8,0.4},
-{-0.6,-0.6,0.5},
-{-0.5,-0.8,0.4},
-{-0.4,-0.8,0.4},
-{-0.5,-0.7,0.5},
-{-0.5,-0.7,0.5},
-{-0.4,-0.8,0.5},
-{-0.5,-0.6,0.6},
-{0.7,-0.7,0.3},
-{0.8,-0.5,0.4},
-{0.6,-0.6,0.5},
-{0.8,-0.5,0.4},
-{0.8,-0.4,0.4},
-{0.7,-0.5,0.5},
-{0.7,-0.5,0.5},
-{0.8,-0.4,0.5},
-{0.6,-0.5,0.6},
-{-0.3,-0.7,0.7},
-{-0.4,-0.5,0.8},
-{-0.5,-0.6,0.6},
-{-0.4,-0.5,0.8},
-{-0.4,-0.4,0.8},
-{-0.5,-0.5,0.7},
-{-0.5,-0.5,0.7},
-{-0.5,-0.4,0.8},
-{-0.6,-0.5,0.6},
-{-0.7,-0.3,-0.7},
-{-0.5,-0.4,-0.8},
-{-0.6,-0.5,-0.6},
-{-0.5,-0.4,-0.8},
-{-0.4,-0.4,-0.8},
-{-0.5,-0.5,-0.7},
-{-0.5,-0.5,-0.7},
-{-0.4,-0.5,-0.8},
-{-0.5,-0.6,-0.6},
-};
-
-const int numsphereNorm = sizeof(sphereNorm)/(sizeof(GLfloat)*3);
-